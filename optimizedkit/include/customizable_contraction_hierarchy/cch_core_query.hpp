@@ -0,0 +1,85 @@
+#ifndef OPTIMIZEDKIT_CCH_CORE_QUERY_HPP
+#define OPTIMIZEDKIT_CCH_CORE_QUERY_HPP
+
+#include <vector>
+#include <utility>
+#include "cch_core_reduction.hpp"
+#include "cch_customizer.hpp"
+#include "cch_query.hpp"
+#include "utils/enums.hpp"
+#include "utils/constants.hpp"
+
+namespace OptimizedKit {
+    // A core vertex a removed vertex reaches or is reached from, with the weight of the walk and the position of the
+    // vertex on the chain of the walk, invalid if the walk does not use a chain.
+    template<typename WeightType>
+    struct CchCoreExit {
+        VertexId coreVertex;
+        WeightType weight;
+        EdgeId chainPosition;
+    };
+
+    // Queries between input vertices on a CCH built on the core of a reduction. Removed endpoints walk up their tree to
+    // its anchor and along the chain of the anchor to the core, the core search starts from all reached core vertices.
+    // Endpoints in the same tree or on the same chain also compete with the path staying there.
+    template<typename WeightType>
+    class CchCoreQuery {
+        using Traits = WeightTraits<WeightType>;
+
+    public:
+        // The customizer must be built on the core graph with the reduced input weights, the input weights are read by
+        // the walks outside the core.
+        CchCoreQuery(const CchCoreReduction &reduction, const CchCustomizer<WeightType> &coreCustomizer,
+                     const std::vector<WeightType> &inputWeights, HeapType heapType = HeapType::PAIRING);
+
+        CchCoreQuery(const CchCoreReduction &reduction, const CchCustomizer<WeightType> &coreCustomizer,
+                     const WeightType *inputWeights, HeapType heapType = HeapType::PAIRING);
+
+        CchCoreQuery &run(VertexId source, VertexId target);
+
+        WeightType getQueryWeight();
+
+        // Input edges of the shortest path.
+        std::vector<EdgeId> getEdgePath();
+
+        std::vector<VertexId> getVertexPath();
+
+        QueryState getState() { return state; }
+
+    // private:
+        const CchCoreReduction *reduction;
+        const WeightType *inputWeights;
+        CchQuery<WeightType> coreQuery;
+        QueryState state{QueryState::INITIALIZED};
+
+        VertexId source{INVALID_VALUE<VertexId>}, target{INVALID_VALUE<VertexId>};
+        WeightType queryWeight{};
+        std::vector<CchCoreExit<WeightType>> sourceExits;
+        std::vector<CchCoreExit<WeightType>> targetExits;
+
+        // Paths not entering the core, through the lowest common ancestor of a shared tree or along a shared chain.
+        VertexId sharedTreeAncestor{INVALID_VALUE<VertexId>};
+        bool isOnSharedChain{false};
+
+        WeightType hopWeight(EdgeId hop, bool forward) const;
+
+        WeightType treeWeight(VertexId x, VertexId ancestor, bool upwards) const;
+
+        WeightType chainWeight(EdgeId fromPosition, EdgeId toPosition) const;
+
+        void collectExits(VertexId anchor, WeightType treeWalkWeight, bool forward,
+                          std::vector<CchCoreExit<WeightType>> &exits) const;
+
+        void appendHop(EdgeId hop, bool forward, std::vector<EdgeId> &path) const;
+
+        void appendTreePath(VertexId x, VertexId ancestor, bool upwards, std::vector<EdgeId> &path) const;
+
+        void appendChainPath(EdgeId fromPosition, EdgeId toPosition, std::vector<EdgeId> &path) const;
+
+        void appendCorePath(std::vector<EdgeId> &path);
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_core_query.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_CORE_QUERY_HPP
@@ -0,0 +1,100 @@
+#ifndef OPTIMIZEDKIT_CCH_CORE_REDUCTION_HPP
+#define OPTIMIZEDKIT_CCH_CORE_REDUCTION_HPP
+
+#include <vector>
+#include <algorithm>
+#include "graph/graph.hpp"
+#include "utils/constants.hpp"
+#include "utils/vector_helper.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    // Reduces a graph to the core a CCH is built on. Dangling trees are peeled off and chains of vertices with two
+    // neighbours are collapsed into single core edges, neighbours counted without direction and multiplicity. Both only
+    // remove vertices without routing decisions, every path into a tree leaves it at its anchor and every path through
+    // a chain runs from one end to the other. A single vertex of every tree component and of every cycle component
+    // remains in the core.
+    //
+    // The CCH is built on coreGraph with reduceOrder(order) and customized with reduceWeights(weights), a CchCoreQuery
+    // answers queries between input vertices by walking from removed vertices to the core.
+    class CchCoreReduction {
+    public:
+        explicit CchCoreReduction(const Graph &graph);
+
+        [[nodiscard]] unsigned long inputVertexCount() const { return coreVertexOfInputVertex.size(); }
+
+        [[nodiscard]] unsigned long coreVertexCount() const { return inputVertexOfCoreVertex.size(); }
+
+        [[nodiscard]] bool isCoreVertex(VertexId x) const { return coreVertexOfInputVertex[x] != INVALID_VALUE<VertexId>; }
+
+        // Order of the core vertices keeping the relative order of an order of the input vertices.
+        [[nodiscard]] Order reduceOrder(const Order &inputOrder) const;
+
+        // Weights of the core edges by input edge weights, chain edges sum the cheapest parallel edge of every hop.
+        // The customizer keeps a pointer to the weights, they must be reduced again after input weights changed.
+        template<typename WeightType>
+        [[nodiscard]] std::vector<WeightType> reduceWeights(const std::vector<WeightType> &inputWeights) const {
+            return reduceWeights(inputWeights.data());
+        }
+
+        template<typename WeightType>
+        [[nodiscard]] std::vector<WeightType> reduceWeights(const WeightType *inputWeights) const;
+
+        // Cheapest input edge of a hop in or against the direction of the hop, invalid if there is none.
+        template<typename WeightType>
+        [[nodiscard]] EdgeId bestHopEdge(EdgeId hop, bool forward, const WeightType *inputWeights) const;
+
+        // Bytes of every member array.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        // Endpoints of the input edges.
+        std::vector<VertexId> inputTail;
+        std::vector<VertexId> inputHead;
+
+        // Core graph by core vertex, core edges are either kept input edges or one direction of a chain.
+        Graph coreGraph;
+        VertexMapping coreVertexOfInputVertex;
+        VertexMapping inputVertexOfCoreVertex;
+        EdgeMapping inputEdgeOfCoreEdge;
+        std::vector<VertexId> chainOfCoreEdge;
+        Filter isCoreEdgeBackwards;
+
+        // Hops between two adjacent removed or chain vertices with all parallel input edges, forward leaves hopTail.
+        std::vector<VertexId> hopTail;
+        std::vector<EdgeId> hopEdgeIndices;
+        std::vector<EdgeId> hopEdges;
+
+        // Peeled trees by input vertex, the anchor is the remaining vertex the tree hangs off. Remaining vertices are
+        // their own anchor with depth zero.
+        std::vector<VertexId> treeParent;
+        std::vector<EdgeId> treeParentHop;
+        std::vector<VertexId> treeAnchor;
+        std::vector<VertexId> treeDepth;
+
+        // Chains from one core vertex to another, possibly the same, with the hop following every chain position.
+        std::vector<VertexId> chainOfVertex;
+        std::vector<EdgeId> chainPositionOfVertex;
+        std::vector<EdgeId> chainVertexIndices;
+        std::vector<VertexId> chainVertices;
+        std::vector<EdgeId> hopAfterChainPosition;
+    private:
+        void peelTrees(const std::vector<EdgeId> &incidenceIndices, const std::vector<EdgeId> &incidentEdges,
+                       std::vector<VertexId> &degree);
+
+        void collapseChains(const std::vector<EdgeId> &incidenceIndices, const std::vector<EdgeId> &incidentEdges,
+                            const std::vector<VertexId> &degree);
+
+        void buildCoreGraph();
+
+        EdgeId addHop(VertexId from, VertexId to, const std::vector<EdgeId> &incidenceIndices,
+                      const std::vector<EdgeId> &incidentEdges);
+
+        [[nodiscard]] VertexId otherEnd(EdgeId edge, VertexId x) const {
+            return inputTail[edge] == x ? inputHead[edge] : inputTail[edge];
+        }
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_core_reduction.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_CORE_REDUCTION_HPP
@@ -2,7 +2,18 @@
 #define OPTIMIZEDKIT_CCH_CUSTOMIZER_HPP
 
 #include <vector>
+#include <algorithm>
+#include <span>
+#include <utility>
+#include <chrono>
+#include <thread>
+#include <atomic>
+#include <barrier>
+#include <memory>
+#include <mutex>
+#include <limits>
 #include <iostream>
+#include <stdexcept>
 #include "cch_preprocessor.hpp"
 #include "graph/graph.hpp"
 #include "utils/enums.hpp"
@@ -11,14 +22,46 @@
 #include "utils/vector_helper.hpp"
 #include "utils/id_mapper.hpp"
 #include "utils/math.hpp"
+#include "utils/graph_helper.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/huge_pages.hpp"
+#include "utils/worker_pool.hpp"
 #include "priority_queues/binary_min_heap.hpp"
 #include "priority_queues/pairing_min_heap.hpp"
+#include "priority_queues/monotone_bitset_queue.hpp"
 #include "cch_triangle_enumeration.hpp"
 #include "customizable_contraction_hierarchy/cch_triangle_enumeration.hpp"
 
 namespace OptimizedKit {
+    template<typename WeightType>
+    class CchGraph;
+
+    template<typename WeightType>
+    class CchQueryGraph;
+
+    template<typename WeightType>
+    class CchServingIndex;
+
+    /**
+     * @brief Work counters of the last partial update batch of a CCH customizer.
+     */
+    struct UpdateStatistics {
+        unsigned long long numInputEdgesUpdated = 0;
+        unsigned long long numCchEdgesProcessed = 0;
+        unsigned long long numCchEdgesChanged = 0;
+        unsigned long long numTrianglesEnumerated = 0;
+        unsigned long long numPerfectVerticesProcessed = 0;
+        unsigned long long numCchEdgesChangedReachability = 0;
+        bool usedFullCustomization = false;
+    };
+
+    // Minimum number of cch edges per thread before the metric extraction is split across threads.
+    constexpr unsigned PARALLEL_GATHER_BLOCK_SIZE = 1u << 16;
+
     template<typename WeightType>
     class CchCustomizer {
+        using Traits = WeightTraits<WeightType>;
+
     public:
         CchCustomizer(CchPreprocessor &preprocessor, const std::vector<WeightType> &weights, HeapType heapType_ = HeapType::PAIRING, bool debug_ = false);
 
@@ -32,24 +75,191 @@ namespace OptimizedKit {
 
         CchCustomizer &reset(const WeightType *weights);
 
-        CchCustomizer &update(const std::vector<unsigned> &updateIds);
+        // Re-customizes the given input edges after the caller changed their weights in its own array. Once deltas were
+        // applied, the weights of these edges are copied from the caller's array into the staged copy first.
+        CchCustomizer &update(const std::vector<EdgeId> &updateIds);
+
+        // Writes the new weights into a private copy of the input weights staged on first use and re-customizes the
+        // changed edges, the caller's array is left untouched.
+        CchCustomizer &applyWeightDeltas(std::span<const std::pair<EdgeId, WeightType>> weightDeltas);
+
+        // Input weights the metric is customized from since the first applied deltas, empty before.
+        [[nodiscard]] const std::vector<WeightType> &getStagedInputWeights() const { return stagedInputWeights; }
+
+        // The worker threads of the parallel mode are started here once and reused by every update.
+        CchCustomizer &setUpdateMode(UpdateMode mode, unsigned threads = std::thread::hardware_concurrency());
+
+        // Updates fall back to a full re-customization once their estimated cost exceeds factor times the measured
+        // duration of a full customization, 1 is the break-even point and infinity disables the fallback. The
+        // estimate needs one measured partial update and one measured customization, updateStatistics reports
+        // whether the fallback was taken.
+        CchCustomizer &setFullCustomizationBreakEven(double factor);
+
+        // Secondary attributes by input edge (e.g. length, toll) carried along each cch edge from the input edge or lower
+        // triangle winning the primary minimum, ties go to the lexicographically smallest attributes. Requires a
+        // re-customization.
+        CchCustomizer &setSecondaryAttributes(const std::vector<std::vector<WeightType>> &attributes);
+
+        [[nodiscard]] unsigned secondaryAttributeCount() const { return attributeCount; }
 
         CchCustomizer &baseCustomization();
 
         CchCustomizer &perfectCustomization();
 
+        [[nodiscard]] EdgeId perfectEdgeCount() const;
+
+        // Weights of a cch edge after perfect customization, directions shortened by a witness via higher vertices are
+        // not part of any shortest path and disabled. The query graph leaves out edges disabled in both directions.
+        [[nodiscard]] WeightType prunedForwardWeight(EdgeId edge) const;
+
+        [[nodiscard]] WeightType prunedBackwardWeight(EdgeId edge) const;
+
+        [[nodiscard]] CustomizerState getState() const { return state; }
+
+        [[nodiscard]] bool mayReach(VertexId source, VertexId target) const;
+
+        // Frees the state only needed to update the metric, the metric must be customized again before updates. A
+        // perfect metric is packed into the query graph first as packing needs the perfect weights.
+        CchCustomizer &releaseUpdateState();
+
+        // Bytes of every member array, the input weights are owned by the caller and not included.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        // Advises the metric arrays to be backed by transparent huge pages and returns the advised bytes, see
+        // CchPreprocessor::adviseHugePages. The shared query graph is moved into memory of the policy.
+        std::size_t adviseHugePages(HugePagePolicy policy = HugePagePolicy::TRANSPARENT) const;
+
+        // Packed query graph of the current metric shared by all queries of this customizer, packed on first use after
+        // the metric changed. A new graph is packed for every metric, queries holding an older one keep their snapshot.
+        // The graph of a perfect metric only holds the arcs not pruned in both directions.
+        [[nodiscard]] std::shared_ptr<const CchQueryGraph<WeightType>> getQueryGraph() const;
+
         std::vector<WeightType> forwardWeights;
         std::vector<WeightType> backwardWeights;
+        std::vector<WeightType> perfectForwardWeights;
+        std::vector<WeightType> perfectBackwardWeights;
         const WeightType *inputWeights;
         CchPreprocessor *cchPreprocessor{};
         long long numChangedWeights = 0;
+
+        // Secondary attributes interleaved by edge, i.e. attribute k of edge e is at e * secondaryAttributeCount() + k.
+        std::vector<WeightType> inputAttributes;
+        std::vector<WeightType> forwardAttributes;
+        std::vector<WeightType> backwardAttributes;
+        UpdateStatistics updateStatistics;
+
+        // Incremented whenever the metric changes, allows queries to detect stale copies of the metric.
+        unsigned long long metricVersion = 0;
+
+        // Connected components of the current metric by cch vertex, infinite arcs are treated as absent.
+        std::vector<VertexId> stronglyConnectedComponent;
+        std::vector<VertexId> weaklyConnectedComponent;
+
+        // Measured costs deciding between partial updates and a full re-customization.
+        std::chrono::nanoseconds fullCustomizationDuration{0};
+        double updateNanosPerProcessedEdge = 0;
+        double processedEdgesPerQueuedEdge = 0;
+        double fullCustomizationBreakEven = 1;
     private:
+        // Copies of a serving index pack a query graph of their own instead of sharing the one of the original.
+        friend class CchServingIndex<WeightType>;
+
+        // Private copy of the input weights written by applyWeightDeltas and the caller's array it was staged from.
+        std::vector<WeightType> stagedInputWeights;
+        const WeightType *callerInputWeights{};
+
+        // Sorted input edges with infinite weight when the components were last computed.
+        std::vector<EdgeId> blockedInputEdges;
+
+        [[nodiscard]] bool isStagingInputWeights() const {
+            return !stagedInputWeights.empty() && inputWeights == stagedInputWeights.data();
+        }
+
         void extractEdgeWeight(EdgeId edge);
 
+        void gatherRespectingMetric(EdgeId begin, EdgeId end);
+
         void extractRespectingMetric();
 
+        void extractAttributes();
+
+        void refreshReachability();
+
         void relaxLowerTriangle(EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c);
 
+        void relaxAttributed(WeightType &weight, WeightType *attributes, WeightType candidate,
+                             const WeightType *firstAttributes, const WeightType *secondAttributes = nullptr);
+
+        void setAttributes(WeightType *attributes, const WeightType *inputEdgeAttributes);
+
+        void enqueueUpdate(EdgeId inputEdge);
+
+        template<class OnAffected>
+        bool recustomizeEdge(EdgeId uv, unsigned thread, UpdateStatistics &statistics, const OnAffected &onAffected);
+
+        void recustomizePerfectVertex(VertexId x, UpdateStatistics &statistics);
+
+        void enqueuePerfectUpdate(VertexId x);
+
+        void propagatePerfectUpdates();
+
+        bool isFullCustomizationCheaper() const;
+
+        void propagateUpdates();
+
+        void propagateUpdatesInParallel();
+
+        MonotoneBitsetQueue updateQueue;
+
+        MonotoneBitsetQueue perfectUpdateQueue;
+
+        UpdateMode updateMode = UpdateMode::SEQUENTIAL;
+
+        unsigned threadCount = 1;
+
+        std::shared_ptr<WorkerPool> workerPool;
+
+        // Query graph handed out by getQueryGraph. Copies of a customizer share the immutable graph until their metric
+        // changes, a perfect metric can not be packed again once its update state is released.
+        struct SharedQueryGraph {
+            mutable std::mutex mutex;
+            std::shared_ptr<const CchQueryGraph<WeightType>> graph;
+            unsigned long long metricVersion{};
+            HugePagePolicy hugePagePolicy{HugePagePolicy::NONE};
+
+            SharedQueryGraph() = default;
+
+            SharedQueryGraph(const SharedQueryGraph &other) {
+                std::lock_guard lock(other.mutex);
+                graph = other.graph;
+                metricVersion = other.metricVersion;
+                hugePagePolicy = other.hugePagePolicy;
+            }
+
+            SharedQueryGraph &operator=(const SharedQueryGraph &other) {
+                if (this == &other)
+                    return *this;
+                std::scoped_lock lock(mutex, other.mutex);
+                graph = other.graph;
+                metricVersion = other.metricVersion;
+                hugePagePolicy = other.hugePagePolicy;
+                return *this;
+            }
+        };
+
+        mutable SharedQueryGraph sharedQueryGraph;
+
+        unsigned attributeCount = 0;
+
+        std::vector<uint64_t> queuedEdgeWords;
+
+        std::vector<uint64_t> queuedVertexWords;
+
+        std::vector<std::vector<VertexId>> queuedVerticesByLevel;
+
+        // Secondary attributes of the edge being re-customized before the update, one buffer per update thread.
+        std::vector<std::vector<WeightType>> previousAttributes;
+
         CustomizerState state;
 
         HeapType heapType;
@@ -0,0 +1,86 @@
+#ifndef OPTIMIZEDKIT_CCH_METRIC_OVERLAY_HPP
+#define OPTIMIZEDKIT_CCH_METRIC_OVERLAY_HPP
+
+#include <vector>
+#include <span>
+#include <utility>
+#include <unordered_map>
+#include "cch_customizer.hpp"
+#include "cch_triangle_enumeration.hpp"
+#include "utils/constants.hpp"
+#include "utils/math.hpp"
+#include "utils/memory_usage.hpp"
+#include "priority_queues/monotone_bitset_queue.hpp"
+
+namespace OptimizedKit {
+    // Copy-on-write view of the base metric of a shared customizer, only cch edges whose weight differs are stored.
+    template<typename WeightType>
+    class CchMetricOverlay {
+        using Traits = WeightTraits<WeightType>;
+
+    public:
+        CchMetricOverlay() = default;
+
+        explicit CchMetricOverlay(const CchCustomizer<WeightType> &customizer);
+
+        // Changes input weights on top of the previous changes and re-customizes the affected cch edges locally.
+        CchMetricOverlay &applyWeightDeltas(std::span<const std::pair<EdgeId, WeightType>> weightDeltas);
+
+        CchMetricOverlay &blockInputEdges(const std::vector<EdgeId> &inputEdges);
+
+        // Re-derives all changed cch edges after the base metric of the customizer was updated.
+        CchMetricOverlay &refresh();
+
+        CchMetricOverlay &clear();
+
+        [[nodiscard]] bool isEmpty() const { return cchEdgeWeights.empty(); }
+
+        [[nodiscard]] bool isStale() const { return baseMetricVersion != cchCustomizer->metricVersion; }
+
+        [[nodiscard]] std::size_t changedEdgeCount() const { return cchEdgeWeights.size(); }
+
+        [[nodiscard]] const CchCustomizer<WeightType> &getCustomizer() const { return *cchCustomizer; }
+
+        [[nodiscard]] unsigned long long getVersion() const { return version; }
+
+        [[nodiscard]] bool hasUnblockedEdges() const { return mayUnblockEdges; }
+
+        // The (forward, backward) weights of the cch edges whose weight differs from the base metric.
+        [[nodiscard]] const std::unordered_map<EdgeId, std::pair<WeightType, WeightType>> &getChangedEdgeWeights() const {
+            return cchEdgeWeights;
+        }
+
+        WeightType forwardWeight(EdgeId cchEdge) const;
+
+        WeightType backwardWeight(EdgeId cchEdge) const;
+
+        WeightType inputWeight(EdgeId inputEdge) const;
+
+        // Bytes of the changed weights and the update queue, the base metric is owned by the customizer.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+    private:
+        const CchCustomizer<WeightType> *cchCustomizer{};
+        const CchPreprocessor *cchPreprocessor{};
+        unsigned long long baseMetricVersion{};
+
+        // Incremented on every change, lets queries detect that their packed copy of the overlay is outdated.
+        unsigned long long version{};
+
+        // Set once an input edge blocked in the base metric becomes usable, reachability of the base no longer holds.
+        bool mayUnblockEdges{false};
+
+        // Changed input weights and the resulting (forward, backward) weights of changed cch edges.
+        std::unordered_map<EdgeId, WeightType> inputEdgeWeights;
+        std::unordered_map<EdgeId, std::pair<WeightType, WeightType>> cchEdgeWeights;
+        MonotoneBitsetQueue updateQueue;
+
+        void propagateUpdates();
+
+        void recustomizeEdge(EdgeId uv);
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_metric_overlay.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_METRIC_OVERLAY_HPP
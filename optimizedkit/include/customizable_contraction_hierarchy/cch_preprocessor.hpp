@@ -4,67 +4,150 @@
 #include <iostream>
 #include <vector>
 #include "graph/graph.hpp"
+#include "graph/compressed_graph.hpp"
 #include "utils/enums.hpp"
 #include "utils/permutation.hpp"
 #include "utils/constants.hpp"
 #include "utils/vector_helper.hpp"
-#include "utils/id_mapper.hpp"
+#include "utils/rank_bit_vector.hpp"
 #include "utils/math.hpp"
+#include "utils/graph_helper.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/memory_tracker.hpp"
+#include "utils/huge_pages.hpp"
 
 namespace OptimizedKit {
     class CchPreprocessor {
     public:
-        CchPreprocessor(OptimizedKit::Order inputOrder, OptimizedKit::Graph graph);
+        // With the elimination tree layout the cch vertices are renumbered in a post-order of the elimination tree of the
+        // order. Any such order contracts to the same hierarchy, order and rank then map to the renumbered vertices.
+        CchPreprocessor(OptimizedKit::Order inputOrder, OptimizedKit::Graph graph,
+                        CchVertexLayout layout = CchVertexLayout::RANK);
 
         [[nodiscard]] unsigned long cchVertexCount() const { return rank.size(); }
 
-        [[nodiscard]] unsigned cchEdgeCount() const { return upwardsGraph.getEdgeCount(); }
+        [[nodiscard]] EdgeId cchEdgeCount() const {
+            return hasCompressedTopology() ? compressedUpwardsGraph.getEdgeCount() : upwardsGraph.getEdgeCount();
+        }
 
         [[nodiscard]] unsigned long inputVertexCount() const { return order.size(); }
 
         void removeEdges(const Filter &removeEdgeFilter);
 
+        // Frees the arrays only needed to build the hierarchy and to customize it, queries and unpacking keep working.
+        void releasePreprocessingState();
+
+        // Builds the compressed upwards and downwards graphs and frees the uncompressed ones. Triangle enumeration,
+        // edge lookups and downwards iteration decode the compressed graphs afterwards. Only meant for a customized
+        // hierarchy whose query graph is already packed, e.g. by CchServingIndex, as neither customization, overlays,
+        // blocked edges nor edge removal work on the compressed topology.
+        void compressTopology();
+
+        [[nodiscard]] bool hasCompressedTopology() const { return !compressedDownwardsGraph.isEmpty(); }
+
+        // Tail and head of an upwards edge, looked up in the compressed graph once the topology is compressed.
+        [[nodiscard]] VertexId upwardsTail(EdgeId edge) const {
+            return hasCompressedTopology() ? compressedUpwardsGraph.tailOf(edge) : upwardsGraph.tail[edge];
+        }
+
+        [[nodiscard]] VertexId upwardsHead(EdgeId edge) const {
+            return hasCompressedTopology() ? compressedUpwardsGraph.headOf(edge) : upwardsGraph.head[edge];
+        }
+
+        // Upwards edge from x to y, INVALID_VALUE if there is none.
+        [[nodiscard]] EdgeId findUpwardsEdge(VertexId x, VertexId y) const;
+
+        // Calls f(downwardsEdge, head) for the lower neighbours of x in increasing order.
+        template<class F>
+        void forEachDownwardsEdge(VertexId x, const F &f) const {
+            if (hasCompressedTopology()) {
+                auto range = compressedDownwardsGraph.adjacency(x);
+                for (auto it = range.begin(); it != range.end(); ++it)
+                    f(it.edge(), *it);
+                return;
+            }
+            for (EdgeId edge = downwardsGraph.adjacencyIndices[x]; edge < downwardsGraph.adjacencyIndices[x + 1]; ++edge)
+                f(edge, downwardsGraph.head[edge]);
+        }
+
+        // Bytes of every member array.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        // Advises every member array to be backed by transparent huge pages and returns the advised bytes. Arrays
+        // reallocated afterwards, e.g. by removing edges, are not advised.
+        std::size_t adviseHugePages(HugePagePolicy policy = HugePagePolicy::TRANSPARENT) const;
+
         // Input variables.
         Order order;
         Graph inputGraph;
         std::vector<VertexId> rank;
-        std::vector<VertexId> inputEdgeIds;
+        EdgeMapping inputEdgeIds;
+
+        // Endpoints of the input edges by original input edge id as cch vertices, the input graph itself is re-sorted.
+        std::vector<VertexId> inputEdgeTail;
+        std::vector<VertexId> inputEdgeHead;
+
+        // Connected components of the input graph by cch vertex, a vertex can only reach lower or equal strong ids.
+        std::vector<VertexId> stronglyConnectedComponent;
+        std::vector<VertexId> weaklyConnectedComponent;
 
         // Input to cch mapping.
-        VertexMapping inputEdgeToCchEdge;
-        VertexMapping cchEdgeToInputEdge;
+        EdgeMapping inputEdgeToCchEdge;
+        EdgeMapping cchEdgeToInputEdge;
         Filter isInputEdgeUpwards;
 
         // Contracted upwards ordered graph for customization and query.
         Graph upwardsGraph;
 
         // Triangle Enumeration Helper.
-        VertexMapping downwardsToUpwardsGraph;
+        EdgeMapping downwardsToUpwardsGraph;
         Graph downwardsGraph;
 
-        // Helper to unpack cch edges to input edges.
-        Filter doesCchEdgeHaveInputEdge;
-        IdMapper doesCchEdgeHaveInputEdgeMapper;
+        // Delta encoded copies of the upwards and downwards graph, empty unless the topology was compressed.
+        CompressedGraph compressedUpwardsGraph;
+        CompressedGraph compressedDownwardsGraph;
+
+        // Elimination tree levels, edges with tails on the same level are independent during customization.
+        std::vector<VertexId> eliminationTreeLevel;
+        VertexId eliminationTreeLevelCount{};
+
+        // Helper to unpack cch edges to input edges, the rank of a cch edge is its local id.
+        RankBitVector doesCchEdgeHaveInputEdge;
         std::vector<EdgeId> forwardInputEdgeOfCchEdge;
         std::vector<EdgeId> backwardInputEdgeOfCchEdge;
-        Filter doesCchEdgeHaveExtraInputEdge;
-        IdMapper doesCchEdgeHaveExtraInputEdgeMapper;
+        RankBitVector doesCchEdgeHaveExtraInputEdge;
         std::vector<EdgeId> extraForwardInputEdgeOfCchAdjacencyEdges;
         std::vector<EdgeId> extraBackwardInputEdgeOfCchAdjacencyEdges;
         std::vector<EdgeId> extraForwardInputEdgeOfCch;
         std::vector<EdgeId> extraBackwardInputEdgeOfCch;
+
+        // Flat metric extraction plan, gather one input edge per cch edge and minimize over the remaining input edges.
+        std::vector<EdgeId> forwardGatherInputEdge;
+        std::vector<EdgeId> backwardGatherInputEdge;
+        std::vector<EdgeId> forwardReductionCchEdge;
+        std::vector<EdgeId> forwardReductionInputEdge;
+        std::vector<EdgeId> backwardReductionCchEdge;
+        std::vector<EdgeId> backwardReductionInputEdge;
     private:
         void applyOrder();
 
         void sortGraph();
 
+        void buildConnectedComponents();
+
         void buildUpwardsGraph();
 
+        void applyEliminationTreeLayout();
+
         void buildInputToCchMapping();
 
         void buildDownwardsGraph();
 
+        void buildEliminationTreeLevels();
+
         void buildCchToInputMapping();
+
+        void buildMetricExtractionPlan();
     };
 }
 
@@ -0,0 +1,62 @@
+#ifndef OPTIMIZEDKIT_CCH_QUANTIZED_METRIC_HPP
+#define OPTIMIZEDKIT_CCH_QUANTIZED_METRIC_HPP
+
+#include <vector>
+#include <type_traits>
+#include "cch_customizer.hpp"
+#include "graph/cch_quantized_query_graph.hpp"
+#include "utils/constants.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    // Query-only snapshot of the customized metric of a customizer, about half the size of the 32-bit weights and
+    // decoded exactly. The customizer may be re-customized for another metric afterwards, its preprocessor must outlive
+    // the snapshot. Queries search the quantized weights in place, no decoded copy of the metric is kept.
+    template<typename WeightType>
+    class CchQuantizedMetric {
+    public:
+        CchQuantizedMetric() = default;
+
+        explicit CchQuantizedMetric(const CchCustomizer<WeightType> &customizer);
+
+        WeightType forwardWeight(EdgeId cchEdge) const {
+            return forwardWeights(cchEdge, cchPreprocessor->upwardsTail(cchEdge));
+        }
+
+        WeightType backwardWeight(EdgeId cchEdge) const {
+            return backwardWeights(cchEdge, cchPreprocessor->upwardsTail(cchEdge));
+        }
+
+        WeightType inputWeight(EdgeId inputEdge) const {
+            return inputWeights(inputEdge, cchPreprocessor->inputEdgeTail[inputEdge]);
+        }
+
+        [[nodiscard]] bool mayReach(VertexId source, VertexId target) const;
+
+        // View of the upwards graph decoding the weights during the search, only valid while the topology is uncompressed.
+        [[nodiscard]] CchQuantizedQueryGraph<WeightType> getQueryGraph() const;
+
+        [[nodiscard]] std::size_t outlierCount() const {
+            return forwardWeights.outliers.size() + backwardWeights.outliers.size() + inputWeights.outliers.size();
+        }
+
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+    // private:
+        const CchCustomizer<WeightType> *cchCustomizer{};
+        const CchPreprocessor *cchPreprocessor{};
+
+        // Cch edges are grouped by their tail in the upwards graph, input edges by their tail as cch vertex.
+        QuantizedWeights<WeightType> forwardWeights;
+        QuantizedWeights<WeightType> backwardWeights;
+        QuantizedWeights<WeightType> inputWeights;
+
+        // Connected components of the snapshot metric, see CchCustomizer::mayReach.
+        std::vector<VertexId> stronglyConnectedComponent;
+        std::vector<VertexId> weaklyConnectedComponent;
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_quantized_metric.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_QUANTIZED_METRIC_HPP
@@ -3,6 +3,10 @@
 
 #include <iostream>
 #include <vector>
+#include <algorithm>
+#include <memory>
+#include <cmath>
+#include <type_traits>
 #include "cch_customizer.hpp"
 #include "graph/graph.hpp"
 #include "graph/cch_graph.hpp"
@@ -14,45 +18,180 @@
 #include "utils/id_mapper.hpp"
 #include "path_finding_algorithms/bi_directional_dijkstra.hpp"
 #include "customizable_contraction_hierarchy/cch_triangle_enumeration.hpp"
+#include "customizable_contraction_hierarchy/cch_metric_overlay.hpp"
+#include "customizable_contraction_hierarchy/cch_quantized_metric.hpp"
+#include "customizable_contraction_hierarchy/cch_serving_index.hpp"
 
 namespace OptimizedKit {
+    // A position on an input edge, the offset is the travelled fraction of the edge from its tail.
+    struct EdgePosition {
+        EdgeId edge;
+        double offset;
+    };
+
     template<typename WeightType>
     class CchQuery {
+        using Traits = WeightTraits<WeightType>;
+
     public:
         explicit CchQuery(const CchCustomizer<WeightType> &customizer, HeapType heapType = HeapType::PAIRING);
 
+        // Queries a personalized metric, the overlay must outlive the query and be refreshed after base updates.
+        explicit CchQuery(const CchMetricOverlay<WeightType> &overlay, HeapType heapType = HeapType::PAIRING);
+
+        // Queries a quantized snapshot, the customizer of the snapshot is only used for its topology afterwards.
+        explicit CchQuery(const CchQuantizedMetric<WeightType> &metric, HeapType heapType = HeapType::PAIRING);
+
+        explicit CchQuery(const CchServingIndex<WeightType> &index, HeapType heapType = HeapType::PAIRING);
+
         CchQuery<WeightType> &run(VertexId source, VertexId target, bool debug = false);
 
+        // Best of many query, every source and target is an input vertex with the initial distance to reach it.
+        CchQuery<WeightType> &run(const std::vector<std::pair<VertexId, WeightType>> &sources,
+                                  const std::vector<std::pair<VertexId, WeightType>> &targets, bool debug = false);
+
+        // Query between positions on input edges, edge paths then start with the source and end with the target edge.
+        CchQuery<WeightType> &run(const EdgePosition &source, const EdgePosition &target, bool debug = false);
+
+        // Source and target the shortest path starts and ends at.
+        VertexId getSource();
+
+        VertexId getTarget();
+
         std::vector<VertexId> getVertexPath();
 
         std::vector<EdgeId> getEdgePath();
 
         WeightType getQueryWeight();
 
+        // Totals of the secondary attributes of the customizer along the shortest path, seeds contribute nothing.
+        std::vector<WeightType> getSecondaryTotals();
+
         CchQuery<WeightType> &reset(const CchCustomizer<WeightType> &cchCustomizer);
 
+        CchQuery<WeightType> &setQueryMode(QueryMode mode);
+
+        // Input edges this query must avoid, the shared customizer is left untouched.
+        CchQuery<WeightType> &setBlockedEdges(std::vector<EdgeId> inputEdges);
+
+        // Reads all weights through the overlay, null queries the shared metric again.
+        CchQuery<WeightType> &setMetricOverlay(const CchMetricOverlay<WeightType> *overlay);
+
+        // Reads all weights from a quantized snapshot, neither overlays nor blocked edges apply to it.
+        CchQuery<WeightType> &setQuantizedMetric(const CchQuantizedMetric<WeightType> *metric);
+
+        // Backs the query graphs packed by this query for overlays and blocked edges with huge pages, see
+        // CchQueryGraph::setHugePagePolicy. The shared graph follows CchCustomizer::adviseHugePages.
+        CchQuery<WeightType> &setHugePagePolicy(HugePagePolicy policy);
+
         QueryState getState();
 
+        // Bytes of the search state, the query graphs packed by this query and the overlay of blocked edges, the
+        // customizer with its shared query graph, its preprocessor and overlays set by the caller are not included.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
     // private:
+        QueryState state{QueryState::UNINITIALIZED};
         const CchCustomizer<WeightType> *cchCustomizer;
         const CchPreprocessor *cchPreprocessor;
-        const CchGraph<WeightType> cchGraph;
         BiDirectionalDijkstra<WeightType> biDirectionalDijkstra;
-        QueryState state{QueryState::UNINITIALIZED};
+        unsigned long long metricVersion{};
 
         std::vector<VertexId> vertexPath;
         std::vector<EdgeId> edgePath;
 
         VertexId globalSource{}, globalTarget{}, localSource{}, localTarget{};
+        std::vector<std::pair<VertexId, WeightType>> localSources;
+        std::vector<std::pair<VertexId, WeightType>> localTargets;
+
+        // Edges of an edge position query, the path may stay on the single edge if both positions share it.
+        EdgeId sourceEdge{INVALID_VALUE<EdgeId>}, targetEdge{INVALID_VALUE<EdgeId>};
+        double sourceOffset{}, targetOffset{};
+        bool isSameEdgePath{false};
+        WeightType sameEdgeWeight{};
+
+        WeightType partialWeight(EdgeId edge, double offset);
+
+        static WeightType partialValue(WeightType value, double offset);
+
+        // Personalized metric and the cch edges of the private query graph currently differing from the base metric.
+        // The private graph is only packed for personalized metrics, the shared metric is searched on the query graph
+        // of the customizer and a quantized snapshot on its quantized weights.
+        const CchMetricOverlay<WeightType> *metricOverlay{};
+        const CchMetricOverlay<WeightType> *patchedOverlay{};
+        unsigned long long patchedOverlayVersion{};
+        std::vector<EdgeId> patchedEdges;
+        std::shared_ptr<CchQueryGraph<WeightType>> privateQueryGraph;
+        unsigned long long privateQueryGraphMetricVersion{};
+
+        // Quantized snapshot queried instead of the customizer and the snapshot whose weights are searched.
+        const CchQuantizedMetric<WeightType> *quantizedMetric{};
+        const CchQuantizedMetric<WeightType> *searchedQuantizedMetric{};
+
+        // Blocked input edges, only repaired in a local overlay if the shortest path of the queried metric uses one.
+        std::vector<EdgeId> blockedInputEdges;
+        CchMetricOverlay<WeightType> blockedOverlay;
+        unsigned long long blockedOverlayMetricVersion{};
+        const CchMetricOverlay<WeightType> *blockedOverlaySource{};
+        unsigned long long blockedOverlaySourceVersion{};
+        bool isBlockedOverlayBuilt{false};
+        bool isBlockedOverlayActive{false};
+        std::shared_ptr<CchQueryGraph<WeightType>> baseQueryGraph;
+        HugePagePolicy hugePagePolicy{HugePagePolicy::NONE};
+        unsigned long long baseQueryGraphMetricVersion{};
+        std::vector<EdgeId> basePatchedEdges;
+
+        bool isBlocked(EdgeId inputEdge) const;
+
+        bool mayReach(VertexId source, VertexId target) const;
+
+        void repairBlockedPath(bool debug);
+
+        void patchQueryGraph(CchQueryGraph<WeightType> &queryGraph, std::vector<EdgeId> &patched,
+                             const CchMetricOverlay<WeightType> *patchOverlay);
+
+        const CchMetricOverlay<WeightType> *activeOverlay() const;
+
+        bool readsCustomizerMetric() const;
+
+        WeightType forwardWeightOf(EdgeId cchEdge) const;
+
+        WeightType backwardWeightOf(EdgeId cchEdge) const;
+
+        WeightType inputWeightOf(EdgeId inputEdge) const;
+
+        void refreshQueryGraph();
+
+        CchQueryGraph<WeightType> &packPrivateQueryGraph(const std::vector<WeightType> &forwardWeights,
+                                                         const std::vector<WeightType> &backwardWeights);
+
+        bool isSearchEnd(VertexId x, bool forward);
 
         EdgeId unpackOriginalEdge(EdgeId cchEdge, bool forward);
 
+        bool hasTightAttributes(bool forward, EdgeId ab, EdgeId ac, EdgeId bc) const;
+
+        bool hasInputAttributes(bool forward, EdgeId cchEdge, EdgeId inputEdge) const;
+
         EdgeId unpackForwardOriginalEdge(EdgeId cchEdge);
 
         EdgeId unpackBackwardOriginalEdge(EdgeId cchEdge);
 
         template<class OnNewSegment>
         void unpackLowerTriangles(bool forward, VertexId x, VertexId y, EdgeId xy, const OnNewSegment &onMissingFound);
+
+        WeightType searchedArcWeight(VertexId a, VertexId x, EdgeId ax, bool forward) const;
+
+        VertexId recoverPredecessor(VertexId x, bool forward);
+
+        bool usesAttributedPaths() const;
+
+        void selectArcAttributes();
+
+        std::vector<VertexId> recoverSearchPath(bool forward);
+
+        template<class OnNewSegment>
+        void unpackPath(const OnNewSegment &onMissingFound);
     };
 }
 
@@ -0,0 +1,48 @@
+#ifndef OPTIMIZEDKIT_CCH_SERVING_INDEX_HPP
+#define OPTIMIZEDKIT_CCH_SERVING_INDEX_HPP
+
+#include <vector>
+#include <utility>
+#include <memory>
+#include "cch_preprocessor.hpp"
+#include "cch_customizer.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/constants.hpp"
+
+namespace OptimizedKit {
+    // Frozen hierarchy and metric holding only what queries and path unpacking read. Takes over a customized customizer
+    // and its preprocessor, frees their preprocessing and update state and copies the input weights. The metric can not
+    // be updated and neither overlays nor blocked edges can be applied to it. Queries point into the index, hence it is
+    // not moved, copies re-point their customizer to their own arrays, e.g. the replicas of CchServingReplicas.
+    // The packed query graph is built once with the index and shared by all of its queries, copies pack their own.
+    // Optionally the topology is compressed, see CchPreprocessor::compressTopology.
+    template<typename WeightType>
+    class CchServingIndex {
+    public:
+        CchServingIndex(CchPreprocessor &&preprocessor_, CchCustomizer<WeightType> &&customizer_,
+                        bool compressTopology = false);
+
+        explicit CchServingIndex(const CchServingIndex &other);
+
+        CchServingIndex &operator=(const CchServingIndex &) = delete;
+
+        [[nodiscard]] const CchCustomizer<WeightType> &getCustomizer() const { return customizer; }
+
+        [[nodiscard]] const CchPreprocessor &getPreprocessor() const { return preprocessor; }
+
+        // Bytes of every array the index keeps.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        // Advises every array the index keeps to be backed by transparent huge pages and returns the advised bytes.
+        std::size_t adviseHugePages(HugePagePolicy policy = HugePagePolicy::TRANSPARENT) const;
+
+    // private:
+        CchPreprocessor preprocessor;
+        std::vector<WeightType> inputWeights;
+        CchCustomizer<WeightType> customizer;
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_serving_index.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_SERVING_INDEX_HPP
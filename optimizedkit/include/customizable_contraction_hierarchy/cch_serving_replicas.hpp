@@ -0,0 +1,51 @@
+#ifndef OPTIMIZEDKIT_CCH_SERVING_REPLICAS_HPP
+#define OPTIMIZEDKIT_CCH_SERVING_REPLICAS_HPP
+
+#include <vector>
+#include <memory>
+#include <thread>
+#include "cch_serving_index.hpp"
+#include "utils/enums.hpp"
+#include "utils/numa_topology.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    // Copies of a serving index, one per NUMA node. Each copy is made by a thread pinned to the cpus of its node, so the
+    // first touch places its arrays in the memory of that node. Worker threads bind themselves to a replica before
+    // constructing their queries, which then pack their query graphs in local memory as well. Like the index, the
+    // replicas are neither copied nor moved.
+    template<typename WeightType>
+    class CchServingReplicas {
+    public:
+        explicit CchServingReplicas(const CchServingIndex<WeightType> &index,
+                                    std::vector<std::vector<unsigned>> cpusOfReplica_ = numaNodeCpus(),
+                                    HugePagePolicy hugePagePolicy = HugePagePolicy::NONE);
+
+        CchServingReplicas(const CchServingReplicas &) = delete;
+
+        CchServingReplicas &operator=(const CchServingReplicas &) = delete;
+
+        [[nodiscard]] std::size_t replicaCount() const { return replicas.size(); }
+
+        [[nodiscard]] const CchServingIndex<WeightType> &replica(std::size_t r) const { return *replicas[r]; }
+
+        [[nodiscard]] const std::vector<unsigned> &cpusOf(std::size_t r) const { return cpusOfReplica[r]; }
+
+        // Pins the calling thread to the cpus of a replica and returns the replica to construct queries from.
+        const CchServingIndex<WeightType> &bindCurrentThread(std::size_t r) const;
+
+        // Replica whose cpus contain the cpu the calling thread runs on, the first replica if there is none.
+        [[nodiscard]] std::size_t replicaOfCurrentThread() const;
+
+        // Bytes of every replica, prefixed by its number.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+    // private:
+        std::vector<std::vector<unsigned>> cpusOfReplica;
+        std::vector<std::unique_ptr<CchServingIndex<WeightType>>> replicas;
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_serving_replicas.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_SERVING_REPLICAS_HPP
@@ -16,6 +16,20 @@ namespace OptimizedKit {
     template<class F>
     void
     enumerateUpperTriangles(const CchPreprocessor &preprocessor, EdgeId ab, const F &f);
+
+    // Variants decoding the compressed topology, the enumerations above dispatch to them once it was compressed.
+    template<class F>
+    void
+    enumerateCompressedLowerTriangles(const CchPreprocessor &preprocessor, EdgeId bc, VertexId b, VertexId c, const F &f);
+
+    template<class F>
+    void
+    enumerateCompressedIntermediateTriangles(const CchPreprocessor &preprocessor, EdgeId ac, VertexId a, VertexId c,
+                                             const F &f);
+
+    template<class F>
+    void
+    enumerateCompressedUpperTriangles(const CchPreprocessor &preprocessor, EdgeId ab, VertexId a, VertexId b, const F &f);
 }
 
 #include "../../src/customizable_contraction_hierarchy/cch_triangle_enumeration.tpp"
@@ -0,0 +1,66 @@
+#ifndef OPTIMIZEDKIT_CCH_TURN_EXPANSION_HPP
+#define OPTIMIZEDKIT_CCH_TURN_EXPANSION_HPP
+
+#include <vector>
+#include <utility>
+#include <algorithm>
+#include "graph/graph.hpp"
+#include "utils/constants.hpp"
+#include "utils/permutation.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    // A turn from an input edge into an input edge leaving the head of the first one.
+    typedef std::pair<EdgeId, EdgeId> Turn;
+
+    // Turn expanded graph of an input graph for a CCH with turn costs and restrictions. Every input edge is a vertex of
+    // the turn graph, reached after travelling along the edge, and every allowed turn is an edge of the turn graph.
+    // Restricted turns are left out of the topology. Turn costs are metric data, the weight of a turn is the cost of
+    // the turn plus the weight of the edge turned into, hence changed costs only need a re-customization.
+    //
+    // The CCH is built on turnGraph with expandOrder(order) and customized with expandWeights(weights, turnCosts), a
+    // CchTurnQuery answers queries between input vertices.
+    class CchTurnExpansion {
+    public:
+        // Turns with costs are numbered by their position in turnsWithCost, restricted turns may not have costs.
+        CchTurnExpansion(const Graph &graph, std::vector<Turn> restrictedTurns, const std::vector<Turn> &turnsWithCost = {});
+
+        [[nodiscard]] unsigned long inputVertexCount() const { return outEdgeIndices.size() - 1; }
+
+        [[nodiscard]] EdgeId inputEdgeCount() const { return inputTail.size(); }
+
+        [[nodiscard]] EdgeId turnCount() const { return turnGraph.getEdgeCount(); }
+
+        // Order of the turn graph derived from an order of the input vertices, input edges are ordered by the higher and
+        // then the lower rank of their ends. Removing the edges at a separator separates the turn graph as well.
+        [[nodiscard]] Order expandOrder(const Order &inputOrder) const;
+
+        // Weights of the turns by input edge weights and the costs of the turns with costs, must be expanded again after
+        // either changed as the customizer keeps a pointer to them.
+        template<typename WeightType>
+        [[nodiscard]] std::vector<WeightType> expandWeights(const std::vector<WeightType> &inputWeights,
+                                                            const std::vector<WeightType> &turnCosts = {}) const;
+
+        // Bytes of every member array.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        // Endpoints of the input edges.
+        std::vector<VertexId> inputTail;
+        std::vector<VertexId> inputHead;
+
+        // Input edges leaving and entering every input vertex.
+        std::vector<EdgeId> outEdgeIndices;
+        std::vector<EdgeId> outEdges;
+        std::vector<EdgeId> inEdgeIndices;
+        std::vector<EdgeId> inEdges;
+
+        // Turn graph by input edge, the edges are the allowed turns with the id of their cost if they have one.
+        Graph turnGraph;
+        std::vector<EdgeId> costOfTurn;
+        EdgeId turnCostCount{};
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_turn_expansion.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_TURN_EXPANSION_HPP
@@ -0,0 +1,55 @@
+#ifndef OPTIMIZEDKIT_CCH_TURN_QUERY_HPP
+#define OPTIMIZEDKIT_CCH_TURN_QUERY_HPP
+
+#include <vector>
+#include <utility>
+#include "cch_turn_expansion.hpp"
+#include "cch_customizer.hpp"
+#include "cch_query.hpp"
+#include "utils/enums.hpp"
+#include "utils/constants.hpp"
+
+namespace OptimizedKit {
+    // Queries between input vertices on a CCH built on the turn graph of an expansion. The search starts from every
+    // edge leaving the source with its weight and ends in any edge entering the target, the first edge is not turned
+    // into and hence pays no turn cost.
+    template<typename WeightType>
+    class CchTurnQuery {
+        using Traits = WeightTraits<WeightType>;
+
+    public:
+        // The customizer must be built on the turn graph with the expanded weights, the input weights are read for the
+        // first edge of a path.
+        CchTurnQuery(const CchTurnExpansion &expansion, const CchCustomizer<WeightType> &turnCustomizer,
+                     const std::vector<WeightType> &inputWeights, HeapType heapType = HeapType::PAIRING);
+
+        CchTurnQuery(const CchTurnExpansion &expansion, const CchCustomizer<WeightType> &turnCustomizer,
+                     const WeightType *inputWeights, HeapType heapType = HeapType::PAIRING);
+
+        CchTurnQuery &run(VertexId source, VertexId target);
+
+        WeightType getQueryWeight();
+
+        // Input edges of the shortest path.
+        std::vector<EdgeId> getEdgePath();
+
+        std::vector<VertexId> getVertexPath();
+
+        QueryState getState() { return state; }
+
+    // private:
+        const CchTurnExpansion *expansion;
+        const WeightType *inputWeights;
+        CchQuery<WeightType> turnQuery;
+        QueryState state{QueryState::INITIALIZED};
+
+        VertexId source{INVALID_VALUE<VertexId>}, target{INVALID_VALUE<VertexId>};
+        WeightType queryWeight{};
+        std::vector<std::pair<VertexId, WeightType>> sources;
+        std::vector<std::pair<VertexId, WeightType>> targets;
+    };
+}
+
+#include "../../src/customizable_contraction_hierarchy/cch_turn_query.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_TURN_QUERY_HPP
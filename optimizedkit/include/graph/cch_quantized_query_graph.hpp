@@ -0,0 +1,112 @@
+#ifndef OPTIMIZEDKIT_CCH_QUANTIZED_QUERY_GRAPH_HPP
+#define OPTIMIZEDKIT_CCH_QUANTIZED_QUERY_GRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <utility>
+#include <algorithm>
+#include "graph/graph.hpp"
+#include "graph/cch_query_graph.hpp"
+#include "utils/constants.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief Weights stored as 16-bit offsets to the smallest finite weight of their group, e.g. of the edges of a tail
+     *        vertex.
+     *
+     * @details Infinite weights and offsets not fitting 16 bits are escaped, the latter into a table sorted by edge.
+     *
+     * @tparam WeightType - The type of the weights.
+     */
+    template<typename WeightType>
+    struct QuantizedWeights {
+        static constexpr std::uint16_t INFINITE_OFFSET = 0xFFFF;
+        static constexpr std::uint16_t ESCAPED_OFFSET = 0xFFFE;
+
+        std::vector<WeightType> base;
+        std::vector<std::uint16_t> offsets;
+        std::vector<std::pair<EdgeId, WeightType>> outliers;
+
+        /**
+         * @brief Quantizes the weights of all edges relative to the base of their group.
+         *
+         * @param weights - The weight of every edge.
+         * @param groupOf - The group of every edge.
+         * @param groupCount - The number of groups.
+         */
+        void build(const WeightType *weights, const std::vector<VertexId> &groupOf, unsigned long groupCount);
+
+        /**
+         * @brief The exact weight of an edge, outliers are searched in the escape table.
+         *
+         * @param edge - The edge.
+         * @param group - The group of the edge.
+         * @return Returns the weight of the edge.
+         */
+        WeightType operator()(EdgeId edge, VertexId group) const;
+
+        [[nodiscard]] MemoryUsage memoryUsage() const {
+            return MemoryUsage().add("base", base).add("offsets", offsets).add("outliers", outliers);
+        }
+    };
+
+    /**
+     * @brief The CCH query graph of a quantized metric, reading the upwards graph and the quantized weights in place.
+     *
+     * @details Arcs are the edges of the upwards graph grouped by their tail, their weights are decoded from base and
+     *          offset while they are relaxed. The view owns no memory, the upwards graph and the weights must outlive it
+     *          and the topology must not be compressed.
+     *
+     * @tparam WeightType - The type of the weights.
+     */
+    template<typename WeightType>
+    class CchQuantizedQueryGraph {
+    public:
+        CchQuantizedQueryGraph() = default;
+
+        /**
+         * @brief Construct a view of the upwards graph with quantized weights grouped by the tail of their edge.
+         *
+         * @param upwardsGraph - The upwards graph.
+         * @param forwardWeights - The quantized forward weights.
+         * @param backwardWeights - The quantized backward weights.
+         * @param vertexCount - The number of vertices.
+         */
+        CchQuantizedQueryGraph(const Graph &upwardsGraph, const QuantizedWeights<WeightType> &forwardWeights,
+                               const QuantizedWeights<WeightType> &backwardWeights, unsigned long vertexCount)
+                : upwardsGraph(&upwardsGraph), forwardWeights(&forwardWeights), backwardWeights(&backwardWeights),
+                  vertexCount(vertexCount) {}
+
+        /**
+         * @brief Arc range of a vertex, the ids of its upwards edges.
+         *
+         * @param x - The vertex.
+         * @return Returns the range of the arcs of x.
+         */
+        [[nodiscard]] CchQueryArcRange arcsOf(VertexId x) const {
+            return {upwardsGraph->adjacencyIndices[x], upwardsGraph->adjacencyIndices[x + 1]};
+        }
+
+        /**
+         * @brief Decodes an arc of a vertex.
+         *
+         * @param x - The tail of the arc.
+         * @param arc - The arc within the range of x.
+         * @return Returns the arc with both weights decoded.
+         */
+        [[nodiscard]] CchQueryArc<WeightType> arcAt(VertexId x, EdgeId arc) const {
+            return {upwardsGraph->head[arc], (*forwardWeights)(arc, x), (*backwardWeights)(arc, x), arc};
+        }
+
+    // private:
+        const Graph *upwardsGraph{};
+        const QuantizedWeights<WeightType> *forwardWeights{};
+        const QuantizedWeights<WeightType> *backwardWeights{};
+        unsigned long vertexCount{};
+    };
+}
+
+#include "../../src/graph/cch_quantized_query_graph.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_QUANTIZED_QUERY_GRAPH_HPP
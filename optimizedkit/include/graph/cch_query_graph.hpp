@@ -0,0 +1,146 @@
+#ifndef OPTIMIZEDKIT_CCH_QUERY_GRAPH_HPP
+#define OPTIMIZEDKIT_CCH_QUERY_GRAPH_HPP
+
+#include <bit>
+#include <vector>
+#include <numeric>
+#include <utility>
+#include <algorithm>
+#include "graph/cch_graph.hpp"
+#include "utils/constants.hpp"
+#include "utils/huge_page_allocator.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief An upwards arc of the CCH query graph with both directions of its metric.
+     *
+     * @details Arcs are aligned to the next power of two of their fields, so that they divide a cache line for both
+     *          widths of vertex and edge ids.
+     *
+     * @tparam WeightType - The type of the weights.
+     */
+    template<typename WeightType>
+    struct alignas(std::bit_ceil(sizeof(VertexId) + 2 * sizeof(WeightType) + sizeof(EdgeId))) CchQueryArc {
+        VertexId head;
+        WeightType forwardWeight;
+        WeightType backwardWeight;
+        EdgeId cchEdge;
+
+        bool operator==(const CchQueryArc &) const = default;
+    };
+
+    /**
+     * @brief The range of arcs of a vertex within the CCH query graph.
+     */
+    struct CchQueryArcRange {
+        EdgeId begin;
+        EdgeId end;
+    };
+
+    /**
+     * @brief A compact copy of the upwards graph and its metric for bi-directional queries.
+     *
+     * @details Each arc stores its head and both weights so that relaxing an arc touches a single cache line. The arc
+     *          block of every vertex starts at a cache line boundary, blocks are padded with unused arcs to achieve this.
+     *          The graph is a snapshot of the metric and must be rebuilt after the metric changed.
+     *
+     * @tparam WeightType - The type of the weights.
+     */
+    template<typename WeightType>
+    class CchQueryGraph {
+        static_assert(CACHE_LINE_SIZE % sizeof(CchQueryArc<WeightType>) == 0, "Query arcs must divide a cache line.");
+    public:
+        CchQueryGraph() = default;
+
+        /**
+         * @brief Construct a CCH query graph by packing the upwards graph and the weights of a CCH graph.
+         *
+         * @param graph - The CCH graph to pack.
+         */
+        explicit CchQueryGraph(const CchGraph<WeightType> &graph);
+
+        /**
+         * @brief Packs the upwards graph and the weights of a CCH graph, reusing the allocated memory.
+         *
+         * @param graph - The CCH graph to pack.
+         * @return Returns a reference to the CCH query graph.
+         */
+        CchQueryGraph &build(const CchGraph<WeightType> &graph);
+
+        /**
+         * @brief Packs the upwards graph with the weights given per cch edge and leaves out every arc infinite in both
+         *        directions, e.g. the arcs disabled by a perfect customization.
+         *
+         * @details The arcs of the remaining cch edges keep their order. Arcs of a compacted graph can not be found by
+         *          the id of their cch edge, hence only graphs packed by build are patched.
+         *
+         * @param upwardsGraph - The upwards graph.
+         * @param vertexCount - The number of vertices.
+         * @param arcWeights - Returns the forward and backward weight of a cch edge.
+         * @return Returns a reference to the CCH query graph.
+         */
+        template<class ArcWeights>
+        CchQueryGraph &buildCompacted(const Graph &upwardsGraph, unsigned long vertexCount, const ArcWeights &arcWeights);
+
+        /**
+         * @brief The arc from x to y.
+         *
+         * @param x - The lower vertex.
+         * @param y - The higher vertex.
+         * @return Returns the arc, or null if the graph has none from x to y.
+         */
+        [[nodiscard]] const CchQueryArc<WeightType> *findArc(VertexId x, VertexId y) const;
+
+        /**
+         * @brief Number of arcs without the padding.
+         */
+        [[nodiscard]] EdgeId arcCount() const;
+
+        /**
+         * @brief Arc range of a vertex.
+         *
+         * @param x - The vertex.
+         * @return Returns the range of the arcs of x.
+         */
+        [[nodiscard]] const CchQueryArcRange &arcsOf(VertexId x) const { return arcRanges[x]; }
+
+        /**
+         * @brief Arc of a vertex.
+         *
+         * @param x - The tail of the arc.
+         * @param arc - The arc within the range of x.
+         * @return Returns the packed arc.
+         */
+        [[nodiscard]] const CchQueryArc<WeightType> &arcAt(VertexId /*x*/, EdgeId arc) const { return arcs[arc]; }
+
+        /**
+         * @brief Moves the arcs into memory of the given huge page policy, arcs spanning less than a huge page keep
+         *        their cache line aligned allocation. Later builds reuse the memory of the policy.
+         *
+         * @param policy - The huge page policy.
+         * @return Returns a reference to the CCH query graph.
+         */
+        CchQueryGraph &setHugePagePolicy(HugePagePolicy policy);
+
+        /**
+         * @brief Bytes allocated by the arc ranges and the padded arcs.
+         *
+         * @return Returns the memory usage of the query graph.
+         */
+        [[nodiscard]] MemoryUsage memoryUsage() const { return MemoryUsage().add("arcRanges", arcRanges).add("arcs", arcs); }
+
+    // private:
+        template<class ArcWeights>
+        CchQueryGraph &pack(const Graph &upwardsGraph, unsigned long vertexCount_, const ArcWeights &arcWeights,
+                            bool keepInfiniteArcs);
+
+        std::vector<CchQueryArcRange> arcRanges;
+        std::vector<CchQueryArc<WeightType>, HugePageAllocator<CchQueryArc<WeightType>, CACHE_LINE_SIZE>> arcs;
+        unsigned long vertexCount{};
+    };
+}
+
+#include "../../src/graph/cch_query_graph.tpp"
+
+#endif //OPTIMIZEDKIT_CCH_QUERY_GRAPH_HPP
@@ -0,0 +1,159 @@
+#ifndef OPTIMIZEDKIT_COMPRESSED_GRAPH_HPP
+#define OPTIMIZEDKIT_COMPRESSED_GRAPH_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include <iterator>
+#include <type_traits>
+#include "graph/graph.hpp"
+#include "utils/types.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/huge_pages.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief A read-only adjacency array without tails whose heads are delta encoded as varints.
+     *
+     * @details The first head of a vertex is stored as zigzag encoded difference to the vertex, every further head as
+     *          difference to its predecessor, hence heads must be sorted within each adjacency range. Edge ids are those
+     *          of the graph it was built from, the heads are only accessible by iterating over an adjacency range.
+     */
+    class CompressedGraph {
+    public:
+        /**
+         * @brief Decoding iterator over the heads of an adjacency range.
+         */
+        class AdjacencyIterator {
+        public:
+            using iterator_category = std::input_iterator_tag;
+            using value_type = VertexId;
+            using difference_type = std::ptrdiff_t;
+            using pointer = const VertexId *;
+            using reference = VertexId;
+
+            AdjacencyIterator() = default;
+
+            AdjacencyIterator(const std::uint8_t *position, VertexId tail, EdgeId edge, EdgeId endEdge)
+                    : position(position), currentEdge(edge), endEdge(endEdge) {
+                if (currentEdge != endEdge) {
+                    auto delta = decodeVarint(this->position);
+                    currentHead = tail + static_cast<VertexId>((delta >> 1) ^ (0 - (delta & 1)));
+                }
+            }
+
+            /**
+             * @brief The head of the current edge.
+             */
+            VertexId operator*() const {
+                assert(currentEdge != endEdge);
+                return currentHead;
+            }
+
+            /**
+             * @brief The id of the current edge.
+             */
+            [[nodiscard]] EdgeId edge() const { return currentEdge; }
+
+            AdjacencyIterator &operator++() {
+                assert(currentEdge != endEdge);
+                if (++currentEdge != endEdge)
+                    currentHead += decodeVarint(position);
+                return *this;
+            }
+
+            bool operator==(const AdjacencyIterator &other) const { return currentEdge == other.currentEdge; }
+
+            bool operator!=(const AdjacencyIterator &other) const { return currentEdge != other.currentEdge; }
+
+        private:
+            const std::uint8_t *position{};
+            EdgeId currentEdge{};
+            EdgeId endEdge{};
+            VertexId currentHead{};
+        };
+
+        /**
+         * @brief The edges of a vertex, usable in range based for loops.
+         */
+        struct AdjacencyRange {
+            AdjacencyIterator first;
+            AdjacencyIterator last;
+
+            [[nodiscard]] AdjacencyIterator begin() const { return first; }
+
+            [[nodiscard]] AdjacencyIterator end() const { return last; }
+        };
+
+        CompressedGraph() = default;
+
+        /**
+         * @brief Compresses a graph with adjacency indices whose heads are sorted within each adjacency range.
+         *
+         * @param graph - The graph to compress.
+         */
+        explicit CompressedGraph(const Graph &graph);
+
+        /**
+         * @brief Adjacency range of a vertex.
+         *
+         * @param x - The vertex.
+         * @return Returns the decoding range over the edges of x.
+         */
+        [[nodiscard]] AdjacencyRange adjacency(VertexId x) const {
+            assert(x < vertexCount);
+            const auto *position = bytes.data() + byteOffsets[x];
+            return {AdjacencyIterator(position, x, adjacencyIndices[x], adjacencyIndices[x + 1]),
+                    AdjacencyIterator(position, x, adjacencyIndices[x + 1], adjacencyIndices[x + 1])};
+        }
+
+        /**
+         * @brief Looks up the tail of an edge by binary search over the adjacency indices.
+         *
+         * @param edge - The edge.
+         * @return Returns the tail of the edge.
+         */
+        [[nodiscard]] VertexId tailOf(EdgeId edge) const;
+
+        /**
+         * @brief Looks up the head of an edge by decoding the adjacency range of its tail.
+         *
+         * @param edge - The edge.
+         * @return Returns the head of the edge.
+         */
+        [[nodiscard]] VertexId headOf(EdgeId edge) const;
+
+        [[nodiscard]] VertexId getVertexCount() const { return vertexCount; }
+
+        [[nodiscard]] EdgeId getEdgeCount() const { return adjacencyIndices.empty() ? 0 : adjacencyIndices.back(); }
+
+        [[nodiscard]] bool isEmpty() const { return adjacencyIndices.empty(); }
+
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        /**
+         * @brief Advises the arrays to be backed by transparent huge pages, see OptimizedKit::adviseHugePages.
+         *
+         * @param policy - The huge page policy.
+         * @return Returns the number of bytes advised.
+         */
+        std::size_t adviseHugePages(HugePagePolicy policy) const;
+
+    // private:
+        std::vector<EdgeId> adjacencyIndices;
+        std::vector<std::uint32_t> byteOffsets;
+        std::vector<std::uint8_t> bytes;
+        VertexId vertexCount{};
+
+        static VertexId decodeVarint(const std::uint8_t *&position) {
+            VertexId value = *position & 0x7F;
+            for (unsigned shift = 7; *position++ & 0x80; shift += 7)
+                value |= static_cast<VertexId>(*position & 0x7F) << shift;
+            return value;
+        }
+
+        void encodeVarint(VertexId value);
+    };
+}
+
+#endif //OPTIMIZEDKIT_COMPRESSED_GRAPH_HPP
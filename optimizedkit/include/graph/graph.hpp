@@ -3,6 +3,8 @@
 
 #include <vector>
 #include "utils/types.hpp"
+#include "utils/memory_usage.hpp"
+#include "utils/huge_pages.hpp"
 #include <cassert>
 
 namespace OptimizedKit {
@@ -12,21 +14,31 @@ namespace OptimizedKit {
 
         Graph(const Graph& other);
 
+        Graph(Graph&& other) = default;
+
+        Graph& operator=(const Graph& other) = default;
+
+        Graph& operator=(Graph&& other) = default;
+
         void addEdge(VertexId tailId, VertexId headId);
 
         [[nodiscard]] EdgeId getEdgeId(VertexId tailId, VertexId headId) const;
 
-        [[nodiscard]] unsigned getEdgeCount() const { return tail.size(); }
+        [[nodiscard]] EdgeId getEdgeCount() const { return tail.size(); }
 
         void createAdjacencyIndices();
 
         void removeEdges(const Filter &removeEdgeFilter);
 
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
+        std::size_t adviseHugePages(HugePagePolicy policy) const;
+
     // private:
         std::vector<VertexId> tail;
         std::vector<VertexId> head;
         std::vector<EdgeId> adjacencyIndices;
-        unsigned vertexCount;
+        VertexId vertexCount;
     };
 }
 
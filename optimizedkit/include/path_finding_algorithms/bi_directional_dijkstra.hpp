@@ -5,33 +5,43 @@
 #include <unordered_set>
 #include <limits>
 #include <memory>
+#include <optional>
 #include <queue>
 #include "priority_queues/binary_min_heap.hpp"
 #include "priority_queues/pairing_min_heap.hpp"
 #include "utils/types.hpp"
 #include "graph/cch_graph.hpp"
+#include "graph/cch_query_graph.hpp"
+#include "graph/cch_quantized_query_graph.hpp"
 #include "utils/math.hpp"
 
 namespace OptimizedKit {
     template<typename WeightType>
     class BiDirectionalDijkstra {
+        using Traits = WeightTraits<WeightType>;
+
     public:
         BiDirectionalDijkstra() = default;
         explicit BiDirectionalDijkstra(const CchGraph<WeightType> &graph, HeapType heapType = HeapType::BINARY) :
-                cchGraph(graph),
+                BiDirectionalDijkstra(std::make_shared<CchQueryGraph<WeightType>>(graph), heapType) {}
+
+        // Searches constructed from the same query graph share it, e.g. all queries of a customizer.
+        explicit BiDirectionalDijkstra(std::shared_ptr<const CchQueryGraph<WeightType>> graph,
+                                       HeapType heapType = HeapType::BINARY) :
+                queryGraph(std::move(graph)),
                 source(INVALID_VALUE<VertexId>),
                 target(INVALID_VALUE<VertexId>),
                 meetingVertex(INVALID_VALUE<VertexId>),
                 shortestPathLength(INFINITY_WEIGHT<WeightType>),
-                vertexCount(graph.vertexCount) {
+                vertexCount(queryGraph->vertexCount) {
             switch (heapType) {
                 case HeapType::BINARY:
-                    forwardQueue = new BinaryMinHeap<WeightType, VertexId>();
-                    backwardQueue = new BinaryMinHeap<WeightType, VertexId>();
+                    forwardQueue = std::make_unique<BinaryMinHeap<WeightType, VertexId>>();
+                    backwardQueue = std::make_unique<BinaryMinHeap<WeightType, VertexId>>();
                     break;
                 case HeapType::PAIRING:
-                    forwardQueue = new PairingMinHeap<WeightType, VertexId>();
-                    backwardQueue = new PairingMinHeap<WeightType, VertexId>();
+                    forwardQueue = std::make_unique<PairingMinHeap<WeightType, VertexId>>();
+                    backwardQueue = std::make_unique<PairingMinHeap<WeightType, VertexId>>();
                     break;
                 default:
                     throw std::invalid_argument("Invalid heap type.");
@@ -39,34 +49,72 @@ namespace OptimizedKit {
         }
         BiDirectionalDijkstra &run(VertexId sourceId, VertexId targetId, bool debug = false);
 
-        ~BiDirectionalDijkstra() {
-            delete forwardQueue;
-            delete backwardQueue;
-        }
+        // Resumable interface, run is start followed by step until it returns false.
+        BiDirectionalDijkstra &start(VertexId sourceId, VertexId targetId);
+
+        // Seeds the searches with several sources and targets, each with the initial distance it is reached with.
+        BiDirectionalDijkstra &start(const std::vector<std::pair<VertexId, WeightType>> &sources,
+                                     const std::vector<std::pair<VertexId, WeightType>> &targets);
+
+        bool step(bool debug = false);
+
+        // Breaks ties between equally short paths by the lexicographically smallest totals of the secondary attributes
+        // of their arcs, interleaved by cch edge. Takes effect with the next start, a count of zero disables it.
+        BiDirectionalDijkstra &setArcAttributes(unsigned count, const WeightType *forwardAttributes,
+                                                const WeightType *backwardAttributes);
+
+        [[nodiscard]] bool tracksPredecessors() const { return queryMode == QueryMode::PATH || attributeCount != 0; }
+
+        // Bytes of the search state, the query graph is shared and not included.
+        [[nodiscard]] MemoryUsage memoryUsage() const;
 
     // private:
+        std::shared_ptr<const CchQueryGraph<WeightType>> queryGraph;
+
+        // Searched instead of the query graph if set, e.g. by queries of a quantized metric.
+        std::optional<CchQuantizedQueryGraph<WeightType>> quantizedQueryGraph;
+
         VertexId source{}, target{}, meetingVertex{};
         WeightType shortestPathLength;
         unsigned long vertexCount{};
 
-        const CchGraph<WeightType> cchGraph;
-
         std::vector<WeightType> forwardDistance;
         std::vector<WeightType> backwardDistance;
 
-        AbstractHeap<WeightType, VertexId>* forwardQueue;
-        AbstractHeap<WeightType, VertexId>* backwardQueue;
+        std::unique_ptr<AbstractHeap<WeightType, VertexId>> forwardQueue;
+        std::unique_ptr<AbstractHeap<WeightType, VertexId>> backwardQueue;
+        bool forwardSearchActive{};
+        bool backwardSearchActive{};
 
+        QueryMode queryMode{QueryMode::PATH};
         std::vector<VertexId> forwardPredecessor;
         std::vector<VertexId> backwardPredecessor;
 
         Filter forwardSettled;
         Filter backwardSettled;
 
+        // Secondary attributes of the arcs and the totals along the predecessors of every reached vertex, interleaved
+        // by vertex. Only valid at vertices reached by the last search.
+        unsigned attributeCount{0};
+        const WeightType *forwardArcAttributes{};
+        const WeightType *backwardArcAttributes{};
+        std::vector<WeightType> forwardAttributeTotals;
+        std::vector<WeightType> backwardAttributeTotals;
+
+        // Vertices reached by the last search in either direction, the next search only resets their entries.
+        std::vector<VertexId> touchedVertices;
+
         long long numEdgesExplored = 0;
         long long numVerticesExplored = 0;
 
         void initialize();
+
+        template<class QueryGraph>
+        bool stepOn(const QueryGraph &graph, bool debug);
+
+        bool relaxAttributeTotals(bool forward, VertexId u, VertexId x, EdgeId cchEdge, bool isShorter);
+
+        bool hasSmallerMeetingTotals(VertexId x) const;
     };
 }
 
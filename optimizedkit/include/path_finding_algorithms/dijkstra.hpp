@@ -4,6 +4,7 @@
 #include "utils/constants.hpp"
 #include "utils/types.hpp"
 #include "graph/cch_graph.hpp"
+#include "graph/cch_query_graph.hpp"
 #include "priority_queues/binary_min_heap.hpp"
 
 namespace OptimizedKit {
@@ -12,7 +13,7 @@ namespace OptimizedKit {
     public:
         Dijkstra() = default;
         explicit Dijkstra(const CchGraph<WeightType> &graph) :
-                cchGraph(graph),
+                queryGraph(graph),
                 source(INVALID_VALUE<VertexId>),
                 vertexCount(graph.upwardsGraph->vertexCount) {}
 
@@ -23,11 +24,11 @@ namespace OptimizedKit {
 
     // private:
         VertexId source{};
-        const CchGraph<WeightType> cchGraph;
+        CchQueryGraph<WeightType> queryGraph;
         BinaryMinHeap<WeightType, VertexId> queue;
         std::vector<VertexId> predecessors;
         std::vector<WeightType> distances;
-        unsigned vertexCount{};
+        VertexId vertexCount{};
 
         void ensureCorrectInitialization();
     };
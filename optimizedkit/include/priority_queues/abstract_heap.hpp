@@ -1,6 +1,8 @@
 #ifndef OPTIMIZEDKIT_ABSTRACT_HEAP_HPP
 #define OPTIMIZEDKIT_ABSTRACT_HEAP_HPP
 
+#include "utils/memory_usage.hpp"
+
 namespace OptimizedKit{
     template<typename KeyType, typename IdType>
     class AbstractHeap{
@@ -23,6 +25,8 @@ namespace OptimizedKit{
 
         [[nodiscard]] virtual int size() const = 0;
 
+        [[nodiscard]] virtual MemoryUsage memoryUsage() const = 0;
+
     };
 }
 
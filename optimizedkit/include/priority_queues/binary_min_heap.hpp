@@ -5,6 +5,8 @@
 #include <string>
 #include <iostream>
 #include <stdexcept>
+#include <limits>
+#include <type_traits>
 #include "abstract_heap.hpp"
 
 namespace OptimizedKit {
@@ -13,7 +15,8 @@ namespace OptimizedKit {
      * @brief A Binary Min-Heap implementation.
      *
      * @details If applied to a graph, the heap's nodes represent the vertices of the graph (= node id) and a distance
-     *          between two vertices (= node key).
+     *          between two vertices (= node key). The position of every node is looked up in an array indexed by id,
+     *          hence ids are dense unsigned integers like vertex ids, and clearing only touches the remaining nodes.
      *
      * @tparam KeyType - The type of the keys stored in the heap, default is unsigned.
      * @tparam IdType - The type of the ids stored in the heap, default is unsigned.
@@ -121,7 +124,7 @@ namespace OptimizedKit {
         [[nodiscard]] std::string printOut() const;
 
         /**
-         * @brief Clears the heap by removing all nodes.
+         * @brief Clears the heap by removing all nodes, the index array keeps its size for the next use.
          */
         void clear();
 
@@ -139,13 +142,24 @@ namespace OptimizedKit {
          */
         [[nodiscard]] int size() const { return heap.size(); }
 
+        /**
+         * @brief Bytes allocated by the heap.
+         *
+         * @return Returns the memory usage of the heap array and the index array.
+         */
+        [[nodiscard]] MemoryUsage memoryUsage() const { return MemoryUsage().add("heap", heap).add("indices", indices); }
+
 //    private:
+        static constexpr unsigned INVALID_INDEX = std::numeric_limits<unsigned>::max();
+
         std::vector<Node> heap;
 
-        std::unordered_map<IdType, unsigned> indices;
+        std::vector<unsigned> indices;
 
         int getIndex(const IdType &id) const;
 
+        void setIndex(const IdType &id, unsigned index);
+
         void siftUp(unsigned index);
 
         void siftDown(unsigned index);
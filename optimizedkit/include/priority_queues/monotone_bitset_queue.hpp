@@ -0,0 +1,99 @@
+#ifndef OPTIMIZEDKIT_MONOTONE_BITSET_QUEUE_HPP
+#define OPTIMIZEDKIT_MONOTONE_BITSET_QUEUE_HPP
+
+#include <vector>
+#include <cstdint>
+#include <cassert>
+#include "utils/types.hpp"
+#include "utils/memory_usage.hpp"
+
+namespace OptimizedKit {
+
+    /**
+     * @brief A monotone worklist over a dense id range backed by a bitset.
+     *
+     * @details Ids are extracted in increasing order and duplicate insertions are merged by the bitset. Extraction only
+     *          scans the words between the smallest and the largest queued id, so if ids are inserted monotonically,
+     *          as in the re-customization of cch edges where triangles only propagate changes towards higher edge ids,
+     *          the work is bounded by the touched id range. The bitset is empty again once drained, allowing reuse
+     *          without clearing.
+     */
+    class MonotoneBitsetQueue {
+    public:
+        /**
+         * @brief Constructs a new empty queue without capacity.
+         */
+        MonotoneBitsetQueue() = default;
+
+        /**
+         * @brief Constructs a new empty queue for ids in [0, capacity).
+         *
+         * @param capacity - The number of ids that can be stored in the queue.
+         */
+        explicit MonotoneBitsetQueue(EdgeId capacity);
+
+        /**
+         * @brief Resizes the queue to hold ids in [0, capacity) and removes all ids.
+         *
+         * @param capacity - The number of ids that can be stored in the queue.
+         */
+        void resize(EdgeId capacity);
+
+        /**
+         * @brief Inserts an id into the queue, duplicates are ignored.
+         *
+         * @param id - The id to insert.
+         * @return Returns true if the id was newly inserted, false if it was already queued.
+         */
+        bool insert(EdgeId id);
+
+        /**
+         * @brief Removes and returns the smallest id in the queue.
+         *
+         * @return Returns the smallest id in the queue.
+         */
+        EdgeId deleteMin();
+
+        /**
+         * @brief Removes all ids from the queue while keeping the capacity.
+         */
+        void clear();
+
+        /**
+         * @brief Checks if the queue is empty.
+         *
+         * @return Returns true if the queue is empty, false otherwise.
+         */
+        [[nodiscard]] bool isEmpty() const { return count == 0; }
+
+        /**
+         * @brief Size of the queue.
+         *
+         * @return Returns the number of ids in the queue.
+         */
+        [[nodiscard]] EdgeId size() const { return count; }
+
+        /**
+         * @brief Capacity of the queue.
+         *
+         * @return Returns the number of ids that can be stored in the queue.
+         */
+        [[nodiscard]] EdgeId capacity() const { return idCapacity; }
+
+        /**
+         * @brief Bytes allocated by the queue.
+         *
+         * @return Returns the memory usage of the queue.
+         */
+        [[nodiscard]] MemoryUsage memoryUsage() const { return MemoryUsage().add("words", words); }
+
+    private:
+        std::vector<uint64_t> words;
+        EdgeId idCapacity = 0;
+        EdgeId count = 0;
+        EdgeId firstWord = 0;
+        EdgeId lastWord = 0;
+    };
+}
+
+#endif //OPTIMIZEDKIT_MONOTONE_BITSET_QUEUE_HPP
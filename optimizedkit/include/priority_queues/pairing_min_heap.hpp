@@ -2,6 +2,8 @@
 #define OPTIMIZEDKIT_PAIRING_MIN_HEAP_HPP
 
 #include <unordered_map>
+#include <stdexcept>
+#include <type_traits>
 #include "abstract_heap.hpp"
 
 namespace OptimizedKit {
@@ -38,6 +40,10 @@ namespace OptimizedKit {
 
         [[nodiscard]] int size() const { return indices.size(); }
 
+        [[nodiscard]] MemoryUsage memoryUsage() const {
+            return MemoryUsage().add("nodes", indices.size() * sizeof(Node)).add("indices", indices);
+        }
+
     private:
         Node *root;
         std::unordered_map<IdType, Node *> indices;
@@ -0,0 +1,57 @@
+#ifndef OPTIMIZEDKIT_ALIGNED_ALLOCATOR_HPP
+#define OPTIMIZEDKIT_ALIGNED_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+
+namespace OptimizedKit {
+    /**
+     * @brief A standard allocator returning memory aligned to a fixed boundary.
+     *
+     * @tparam T - The type of the allocated elements.
+     * @tparam Alignment - The alignment of the allocated memory in bytes, must be a power of two.
+     */
+    template<typename T, std::size_t Alignment>
+    class AlignedAllocator {
+    public:
+        static_assert((Alignment & (Alignment - 1)) == 0 && "Alignment must be a power of two.");
+        static_assert(Alignment >= alignof(T) && "Alignment must not be weaker than the alignment of the type.");
+
+        using value_type = T;
+
+        template<typename U>
+        struct rebind {
+            using other = AlignedAllocator<U, Alignment>;
+        };
+
+        AlignedAllocator() = default;
+
+        template<typename U>
+        explicit AlignedAllocator(const AlignedAllocator<U, Alignment> &) noexcept {}
+
+        /**
+         * @brief Allocates aligned memory for n elements.
+         *
+         * @param n - The number of elements.
+         * @return Returns a pointer to the aligned memory.
+         */
+        T *allocate(std::size_t n) {
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        /**
+         * @brief Frees memory previously returned by allocate.
+         *
+         * @param pointer - The pointer to the memory.
+         * @param n - The number of elements.
+         */
+        void deallocate(T *pointer, std::size_t n) noexcept {
+            ::operator delete(pointer, n * sizeof(T), std::align_val_t(Alignment));
+        }
+
+        template<typename U>
+        bool operator==(const AlignedAllocator<U, Alignment> &) const noexcept { return true; }
+    };
+}
+
+#endif //OPTIMIZEDKIT_ALIGNED_ALLOCATOR_HPP
@@ -2,19 +2,20 @@
 #define OPTIMIZEDKIT_CONSTANTS_HPP
 
 #include <limits>
+#include <cstddef>
+#include "utils/weight_traits.hpp"
 
 namespace OptimizedKit {
     /**
-     * @brief The invalid value used for vertices and edges.
+     * @brief The weight of absent and blocked arcs, as defined by the WeightTraits of the weight type.
      *
-     * @details Using 2^31-1 instead of 2^32-1 avoids 32-bit saturated addition, and this allows the algorithm to
-     *          perform saturated addition efficiently by ensuring that the sum of two 2^31-1 values remains within
-     *          the bounds of a 32-bit integer.
+     * @details For 32-bit integral weights, signed or unsigned, this is 2^31-1 so that the sum of two weights remains
+     *          within the bounds of an unsigned 32-bit integer before it is clamped, see WeightTraits.
      *
-     * @tparam WeightType - The type of the invalid value.
+     * @tparam WeightType - The type of the weights.
      */
     template<typename WeightType>
-    constexpr auto INFINITY_WEIGHT = static_cast<WeightType>(2147483647u);
+    constexpr auto INFINITY_WEIGHT = WeightTraits<WeightType>::infinity();
 
     /**
      * @brief The maximum value of any type as defined by std::numeric_limits.
@@ -24,6 +25,16 @@ namespace OptimizedKit {
     template<typename ValueType>
     constexpr auto INVALID_VALUE = std::numeric_limits<ValueType>::max();
 
+    /**
+     * @brief The assumed size of a cache line in bytes, used to align hot query data.
+     */
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @brief The size of a huge page in bytes, arrays of at least this size may be backed by huge pages.
+     */
+    constexpr std::size_t HUGE_PAGE_SIZE = std::size_t{2} << 20;
+
 }
 
 #endif //OPTIMIZEDKIT_CONSTANTS_HPP
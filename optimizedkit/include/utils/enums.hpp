@@ -11,6 +11,14 @@ namespace OptimizedKit {
         FINISHED
     };
 
+    /**
+     * @brief The bookkeeping of a CCH query, distance only queries do not track predecessors.
+     */
+    enum class QueryMode {
+        PATH,
+        DISTANCE_ONLY
+    };
+
     /**
      * @brief The direction of a bidirectional search.
      */
@@ -28,6 +36,14 @@ namespace OptimizedKit {
         PERFECT_CUSTOMIZED
     };
 
+    /**
+     * @brief The execution mode of partial updates of the CCH customizer.
+     */
+    enum class UpdateMode {
+        SEQUENTIAL,
+        PARALLEL
+    };
+
     /**
      * @brief The type of the heap used.
      */
@@ -35,6 +51,25 @@ namespace OptimizedKit {
         BINARY,
         PAIRING
     };
+
+    /**
+     * @brief The numbering of the CCH vertices, either the ranks of the order or a post-order of its elimination tree.
+     *        Both yield the same hierarchy, the latter stores every subtree of the elimination tree contiguously.
+     */
+    enum class CchVertexLayout {
+        RANK,
+        ELIMINATION_TREE
+    };
+
+    /**
+     * @brief The backing of large arrays, transparent huge pages are advised while explicit ones are reserved pages
+     *        mapped from the huge page pool of the kernel, falling back to transparent ones if the pool is exhausted.
+     */
+    enum class HugePagePolicy {
+        NONE,
+        TRANSPARENT,
+        EXPLICIT
+    };
 }
 
 #endif //OPTIMIZEDKIT_ENUMS_HPP
@@ -18,7 +18,7 @@ namespace OptimizedKit{
      * @param y - Target vertex.
      * @return Returns the edge between x and y.
      */
-    EdgeId findEdge(const std::vector<VertexId>&adjacencyList, const std::vector<VertexId>&head, VertexId x, VertexId y);
+    EdgeId findEdge(const std::vector<EdgeId>&adjacencyList, const std::vector<VertexId>&head, VertexId x, VertexId y);
 
     /**
      * @brief Converts an edge path to a vertex path.
@@ -39,6 +39,41 @@ namespace OptimizedKit{
      * @return Returns the converted edge path.
      */
     std::vector<EdgeId> convertVertexPathToEdgePath(const std::vector<VertexId> &tail, const std::vector<VertexId> &head, std::vector<VertexId> &vertexPath);
+
+    /**
+     * @brief Computes the strongly connected components of a directed graph.
+     *
+     * @details Components are numbered in reverse topological order of the condensation, hence if a vertex x can reach
+     *          a vertex y then the component id of x is larger or equal to the component id of y.
+     *
+     * @param vertexCount - Number of vertices of the graph.
+     * @param tail - Tail of the graph.
+     * @param head - Head of the graph.
+     * @return Returns the component id of every vertex.
+     */
+    std::vector<VertexId> computeStronglyConnectedComponents(VertexId vertexCount, const std::vector<VertexId> &tail, const std::vector<VertexId> &head);
+
+    /**
+     * @brief Computes the weakly connected components of a directed graph.
+     *
+     * @param vertexCount - Number of vertices of the graph.
+     * @param tail - Tail of the graph.
+     * @param head - Head of the graph.
+     * @return Returns the component id of every vertex, numbered consecutively from zero.
+     */
+    std::vector<VertexId> computeWeaklyConnectedComponents(VertexId vertexCount, const std::vector<VertexId> &tail, const std::vector<VertexId> &head);
+
+    /**
+     * @brief Computes a post-order of a forest whose parents have larger ids than their children, e.g. an elimination
+     *        tree.
+     *
+     * @details Every subtree occupies a contiguous range of new ids ending at its root. Children and roots keep their
+     *          relative order, hence forests already numbered this way are mapped onto themselves.
+     *
+     * @param parent - Parent of every vertex, INVALID_VALUE<VertexId> for roots.
+     * @return Returns the new id of every vertex.
+     */
+    std::vector<VertexId> computeForestPostOrder(const std::vector<VertexId> &parent);
 }
 
 #endif //OPTIMIZEDKIT_GRAPH_HELPER_HPP
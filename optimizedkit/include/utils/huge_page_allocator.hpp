@@ -0,0 +1,87 @@
+#ifndef OPTIMIZEDKIT_HUGE_PAGE_ALLOCATOR_HPP
+#define OPTIMIZEDKIT_HUGE_PAGE_ALLOCATOR_HPP
+
+#include <cstddef>
+#include <new>
+#include <type_traits>
+#include "utils/enums.hpp"
+#include "utils/constants.hpp"
+#include "utils/huge_pages.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief A standard allocator backing allocations of at least one huge page with huge pages.
+     *
+     * @details Smaller allocations and all allocations of the policy NONE are served by operator new with the given
+     *          alignment, so the allocator behaves like an AlignedAllocator unless a policy is set. The policy is part of
+     *          the allocator state and moves along with the memory of a container.
+     *
+     * @tparam T - The type of the allocated elements.
+     * @tparam Alignment - The alignment of allocations smaller than a huge page in bytes, must be a power of two.
+     */
+    template<typename T, std::size_t Alignment = alignof(T)>
+    class HugePageAllocator {
+    public:
+        static_assert((Alignment & (Alignment - 1)) == 0 && "Alignment must be a power of two.");
+        static_assert(Alignment >= alignof(T) && "Alignment must not be weaker than the alignment of the type.");
+
+        using value_type = T;
+        using propagate_on_container_copy_assignment = std::true_type;
+        using propagate_on_container_move_assignment = std::true_type;
+        using propagate_on_container_swap = std::true_type;
+
+        template<typename U>
+        struct rebind {
+            using other = HugePageAllocator<U, Alignment>;
+        };
+
+        HugePageAllocator() = default;
+
+        explicit HugePageAllocator(HugePagePolicy policy) noexcept: policy(policy) {}
+
+        template<typename U>
+        explicit HugePageAllocator(const HugePageAllocator<U, Alignment> &other) noexcept: policy(other.policy) {}
+
+        /**
+         * @brief Allocates memory for n elements, backed by huge pages if it spans at least one.
+         *
+         * @param n - The number of elements.
+         * @return Returns a pointer to the aligned memory.
+         */
+        T *allocate(std::size_t n) {
+            if (isHugePageAllocation(n))
+                return static_cast<T *>(allocateHugePages(n * sizeof(T), policy));
+            return static_cast<T *>(::operator new(n * sizeof(T), std::align_val_t(Alignment)));
+        }
+
+        /**
+         * @brief Frees memory previously returned by allocate.
+         *
+         * @param pointer - The pointer to the memory.
+         * @param n - The number of elements.
+         */
+        void deallocate(T *pointer, std::size_t n) noexcept {
+            if (isHugePageAllocation(n))
+                freeHugePages(pointer, n * sizeof(T));
+            else
+                ::operator delete(pointer, n * sizeof(T), std::align_val_t(Alignment));
+        }
+
+        /**
+         * @brief The huge page policy of the allocator.
+         */
+        [[nodiscard]] HugePagePolicy getPolicy() const noexcept { return policy; }
+
+        template<typename U>
+        bool operator==(const HugePageAllocator<U, Alignment> &other) const noexcept { return policy == other.policy; }
+
+    // private:
+        HugePagePolicy policy{HugePagePolicy::NONE};
+
+        [[nodiscard]] bool isHugePageAllocation(std::size_t n) const noexcept {
+            return policy != HugePagePolicy::NONE && n * sizeof(T) >= HUGE_PAGE_SIZE;
+        }
+    };
+}
+
+#endif //OPTIMIZEDKIT_HUGE_PAGE_ALLOCATOR_HPP
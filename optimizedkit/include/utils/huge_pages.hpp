@@ -0,0 +1,56 @@
+#ifndef OPTIMIZEDKIT_HUGE_PAGES_HPP
+#define OPTIMIZEDKIT_HUGE_PAGES_HPP
+
+#include <vector>
+#include <cstddef>
+#include "utils/enums.hpp"
+#include "utils/constants.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief Maps memory aligned to huge pages.
+     *
+     * @details Explicit huge pages are mapped from the huge page pool, if it is exhausted or the policy is transparent
+     *          the memory is mapped with regular pages and advised to be backed by transparent huge pages. On systems
+     *          without huge page support the memory is allocated with operator new.
+     *
+     * @param bytes - The number of bytes, rounded up to a multiple of HUGE_PAGE_SIZE.
+     * @param policy - The huge page policy, must not be NONE.
+     * @return Returns a pointer to memory aligned to HUGE_PAGE_SIZE, throws std::bad_alloc on failure.
+     */
+    void *allocateHugePages(std::size_t bytes, HugePagePolicy policy);
+
+    /**
+     * @brief Unmaps memory previously returned by allocateHugePages.
+     *
+     * @param pointer - The pointer to the memory.
+     * @param bytes - The number of bytes passed to allocateHugePages.
+     */
+    void freeHugePages(void *pointer, std::size_t bytes) noexcept;
+
+    /**
+     * @brief Advises the huge page aligned interior of an existing allocation to be backed by transparent huge pages.
+     *
+     * @details Pages already populated are collapsed into huge pages where the kernel supports it, otherwise they are
+     *          left to the background collapsing of the kernel. Existing memory can not be moved to the huge page pool,
+     *          hence the explicit policy is treated as transparent.
+     *
+     * @param data - The start of the allocation.
+     * @param bytes - The size of the allocation in bytes.
+     * @param policy - The huge page policy, nothing is advised for NONE.
+     * @return Returns the number of bytes advised, a multiple of HUGE_PAGE_SIZE.
+     */
+    std::size_t adviseHugePages(const void *data, std::size_t bytes, HugePagePolicy policy) noexcept;
+
+    /**
+     * @brief Advises the capacity of a vector to be backed by transparent huge pages, see adviseHugePages.
+     *
+     * @return Returns the number of bytes advised.
+     */
+    template<typename T, typename Allocator>
+    std::size_t adviseHugePages(const std::vector<T, Allocator> &vector, HugePagePolicy policy) noexcept {
+        return adviseHugePages(vector.data(), vector.capacity() * sizeof(T), policy);
+    }
+}
+
+#endif //OPTIMIZEDKIT_HUGE_PAGES_HPP
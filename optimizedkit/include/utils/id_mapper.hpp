@@ -5,6 +5,7 @@
 #include <cassert>
 #include "types.hpp"
 #include "vector_helper.hpp"
+#include "memory_usage.hpp"
 
 namespace OptimizedKit {
     /**
@@ -27,14 +28,14 @@ namespace OptimizedKit {
          * @param globalId - The global id to map.
          * @return Returns the local id of the given global id.
          */
-        [[nodiscard]] unsigned toLocal(unsigned globalId) const;
+        [[nodiscard]] EdgeId toLocal(EdgeId globalId) const;
 
         /**
          * @brief Returns the number of local ids.
          *
          * @return Returns the number of local ids.
          */
-        [[nodiscard]] unsigned getLocalIdCount() const {
+        [[nodiscard]] EdgeId getLocalIdCount() const {
             return localIdCount;
         }
 
@@ -45,9 +46,16 @@ namespace OptimizedKit {
          */
         void remove(const Filter &filter);
 
+        /**
+         * @brief Bytes allocated by the mapping.
+         *
+         * @return Returns the memory usage of the mapper.
+         */
+        [[nodiscard]] MemoryUsage memoryUsage() const;
+
     private:
-        std::vector<unsigned> mapping;
-        unsigned localIdCount{};
+        std::vector<EdgeId> mapping;
+        EdgeId localIdCount{};
     };
 }
 
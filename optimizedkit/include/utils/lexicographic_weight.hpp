@@ -0,0 +1,102 @@
+#ifndef OPTIMIZEDKIT_LEXICOGRAPHIC_WEIGHT_HPP
+#define OPTIMIZEDKIT_LEXICOGRAPHIC_WEIGHT_HPP
+
+#include <algorithm>
+#include <cstdint>
+#include <cmath>
+#include <compare>
+#include <limits>
+#include <ostream>
+#include "utils/constants.hpp"
+#include "utils/weight_traits.hpp"
+
+namespace OptimizedKit {
+    /**
+     * @brief A (primary, secondary) weight packed into one 64-bit word and ordered lexicographically.
+     *
+     * @details The primary criterion (e.g. time) occupies the upper and the secondary criterion (e.g. distance) the
+     *          lower 32 bits, hence comparing the packed words compares lexicographically and equally short paths are
+     *          always resolved by the secondary criterion. Addition saturates: a primary sum reaching 2^31-1 yields the
+     *          canonical infinity (2^31-1, 0), which equals INFINITY_WEIGHT<LexicographicWeight>, and secondary sums
+     *          are clamped to 2^32-1. Single criterion weights convert implicitly with a secondary of zero.
+     */
+    class LexicographicWeight {
+    public:
+        /**
+         * @brief The primary value of the infinite weight, equal to the scalar INFINITY_WEIGHT.
+         */
+        static constexpr std::uint32_t INFINITE_PRIMARY = 2147483647u;
+
+        constexpr LexicographicWeight() = default;
+
+        constexpr LexicographicWeight(std::uint32_t primary) : packed(static_cast<std::uint64_t>(primary) << 32) {}
+
+        constexpr LexicographicWeight(std::uint32_t primary, std::uint32_t secondary)
+                : packed(static_cast<std::uint64_t>(primary) << 32 | secondary) {}
+
+        [[nodiscard]] constexpr std::uint32_t primary() const { return static_cast<std::uint32_t>(packed >> 32); }
+
+        [[nodiscard]] constexpr std::uint32_t secondary() const { return static_cast<std::uint32_t>(packed); }
+
+        [[nodiscard]] constexpr bool isInfinite() const { return primary() >= INFINITE_PRIMARY; }
+
+        /**
+         * @brief Adds both criteria, saturating at infinity and at the maximum secondary value.
+         */
+        friend constexpr LexicographicWeight operator+(LexicographicWeight a, LexicographicWeight b) {
+            auto primary = static_cast<std::uint64_t>(a.primary()) + b.primary();
+            if (primary >= INFINITE_PRIMARY)
+                return {INFINITE_PRIMARY};
+            auto secondary = static_cast<std::uint64_t>(a.secondary()) + b.secondary();
+            return {static_cast<std::uint32_t>(primary),
+                    static_cast<std::uint32_t>(std::min<std::uint64_t>(secondary, std::numeric_limits<std::uint32_t>::max()))};
+        }
+
+        constexpr LexicographicWeight &operator+=(LexicographicWeight other) { return *this = *this + other; }
+
+        /**
+         * @brief Subtracts both criteria, the subtrahend must not be larger in either criterion.
+         */
+        friend constexpr LexicographicWeight operator-(LexicographicWeight a, LexicographicWeight b) {
+            return {a.primary() - b.primary(), a.secondary() - b.secondary()};
+        }
+
+        /**
+         * @brief Scales both criteria by a non-negative fraction, rounding to the nearest value.
+         */
+        friend LexicographicWeight operator*(double fraction, LexicographicWeight weight) {
+            return {static_cast<std::uint32_t>(std::llround(fraction * weight.primary())),
+                    static_cast<std::uint32_t>(std::llround(fraction * weight.secondary()))};
+        }
+
+        friend constexpr bool operator==(LexicographicWeight a, LexicographicWeight b) = default;
+
+        friend constexpr auto operator<=>(LexicographicWeight a, LexicographicWeight b) = default;
+
+        friend std::ostream &operator<<(std::ostream &stream, LexicographicWeight weight) {
+            return stream << "(" << weight.primary() << ", " << weight.secondary() << ")";
+        }
+
+    private:
+        std::uint64_t packed{};
+    };
+
+    /**
+     * @brief Weight traits of lexicographic weights, the addition of the type already saturates.
+     */
+    template<>
+    struct WeightTraits<LexicographicWeight> {
+        static constexpr LexicographicWeight infinity() { return {LexicographicWeight::INFINITE_PRIMARY}; }
+
+        static constexpr LexicographicWeight add(LexicographicWeight a, LexicographicWeight b) { return a + b; }
+
+        static constexpr LexicographicWeight min(LexicographicWeight a, LexicographicWeight b) { return b < a ? b : a; }
+
+        static constexpr bool isInfinite(LexicographicWeight weight) { return weight.isInfinite(); }
+    };
+
+    static_assert(sizeof(LexicographicWeight) == sizeof(std::uint64_t));
+    static_assert(INFINITY_WEIGHT<LexicographicWeight> == LexicographicWeight(2147483647u, 0));
+}
+
+#endif //OPTIMIZEDKIT_LEXICOGRAPHIC_WEIGHT_HPP
@@ -59,6 +59,19 @@
          if(updateValue < existingValue)
              existingValue = updateValue;
      }
+
+     /**
+      * @brief Updates the existing value with the update value if the update value is larger than the existing value.
+      *
+      * @tparam T - The type of the numbers.
+      * @param existingValue - The existing value.
+      * @param updateValue - The update value.
+      */
+     template<typename T>
+     void updateIfLarger(T &existingValue, const T &updateValue){
+         if(existingValue < updateValue)
+             existingValue = updateValue;
+     }
  }
 
 #endif //OPTIMIZEDKIT_MATH_HPP
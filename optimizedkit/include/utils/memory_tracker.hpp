@@ -0,0 +1,157 @@
+#ifndef OPTIMIZEDKIT_MEMORY_TRACKER_HPP
+#define OPTIMIZEDKIT_MEMORY_TRACKER_HPP
+
+#include <atomic>
+#include <string>
+#include <vector>
+#include <cstddef>
+#include <memory>
+#include <mutex>
+
+namespace OptimizedKit {
+    /**
+     * @brief Peak memory of a named phase, e.g. a step of the CCH preprocessing.
+     */
+    struct MemoryPhase {
+        std::string name;
+        std::size_t startBytes;
+        std::size_t peakBytes;
+        std::size_t endBytes;
+
+        /**
+         * @brief Bytes the phase allocated on top of the memory live when it started.
+         */
+        [[nodiscard]] std::size_t peakAdditionalBytes() const { return peakBytes - startBytes; }
+    };
+
+    class MemoryPhaseRecording;
+
+    /**
+     * @brief Process wide counter of tracked allocations with the peak per phase.
+     *
+     * @details Only allocations routed through the tracker are counted, i.e. containers using a TrackingAllocator or
+     *          every allocation if an application includes "utils/tracking_operator_new.hpp" in one translation unit.
+     *          Phases are started by the CCH preprocessor for each of its steps and only recorded while the starting
+     *          thread holds a MemoryPhaseRecording, otherwise starting and ending phases does nothing. Counting is
+     *          thread safe.
+     */
+    class MemoryTracker {
+    public:
+        /**
+         * @brief Counts an allocation towards the live bytes and the peak of the running phase.
+         *
+         * @param bytes - The number of bytes allocated.
+         */
+        static void recordAllocation(std::size_t bytes) noexcept;
+
+        /**
+         * @brief Counts a deallocation.
+         *
+         * @param bytes - The number of bytes freed.
+         */
+        static void recordDeallocation(std::size_t bytes) noexcept;
+
+        /**
+         * @brief Ends the running phase if any and starts a new one in the recording of the calling thread.
+         *
+         * @param name - The name of the phase.
+         */
+        static void beginPhase(const std::string &name);
+
+        /**
+         * @brief Ends the running phase of the recording of the calling thread if any.
+         */
+        static void endPhase();
+
+        /**
+         * @brief Bytes currently allocated through the tracker.
+         */
+        static std::size_t liveBytes() noexcept { return live.load(std::memory_order_relaxed); }
+
+    private:
+        friend class MemoryPhaseRecording;
+
+        static inline std::atomic<std::size_t> live{0};
+        static inline std::atomic<std::size_t> phasePeak{0};
+
+        // Only one recording is open at a time as all of them would share the phase peak.
+        static inline std::mutex recordingMutex;
+        static inline thread_local MemoryPhaseRecording *recording = nullptr;
+    };
+
+    /**
+     * @brief Records the phases started by the constructing thread while it is alive, e.g. around building a CCH
+     *        preprocessor.
+     *
+     * @details Recordings on other threads wait until this one is destroyed, phases started by threads without a
+     *          recording are not kept anywhere. Peaks count the tracked allocations of all threads.
+     */
+    class MemoryPhaseRecording {
+    public:
+        MemoryPhaseRecording();
+
+        ~MemoryPhaseRecording();
+
+        MemoryPhaseRecording(const MemoryPhaseRecording &) = delete;
+
+        MemoryPhaseRecording &operator=(const MemoryPhaseRecording &) = delete;
+
+        /**
+         * @brief Phases recorded so far, the running phase is included with its peak so far.
+         *
+         * @return Returns the recorded phases in the order they were started.
+         */
+        [[nodiscard]] std::vector<MemoryPhase> phases() const;
+
+    private:
+        friend class MemoryTracker;
+
+        std::unique_lock<std::mutex> lock;
+        std::vector<MemoryPhase> recordedPhases;
+        bool isPhaseRunning = false;
+    };
+
+    /**
+     * @brief A standard allocator counting its allocations in the memory tracker.
+     *
+     * @tparam T - The type of the allocated elements.
+     */
+    template<typename T>
+    class TrackingAllocator {
+    public:
+        using value_type = T;
+
+        TrackingAllocator() = default;
+
+        template<typename U>
+        TrackingAllocator(const TrackingAllocator<U> &) noexcept {}
+
+        /**
+         * @brief Allocates memory for n elements and records it.
+         *
+         * @param n - The number of elements.
+         * @return Returns a pointer to the memory.
+         */
+        T *allocate(std::size_t n) {
+            T *pointer = std::allocator<T>().allocate(n);
+            MemoryTracker::recordAllocation(n * sizeof(T));
+            return pointer;
+        }
+
+        /**
+         * @brief Frees memory previously returned by allocate and records it.
+         *
+         * @param pointer - The pointer to the memory.
+         * @param n - The number of elements.
+         */
+        void deallocate(T *pointer, std::size_t n) noexcept {
+            MemoryTracker::recordDeallocation(n * sizeof(T));
+            std::allocator<T>().deallocate(pointer, n);
+        }
+
+        template<typename U>
+        bool operator==(const TrackingAllocator<U> &) const noexcept { return true; }
+    };
+}
+
+#endif //OPTIMIZEDKIT_MEMORY_TRACKER_HPP
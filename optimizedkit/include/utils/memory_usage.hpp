@@ -0,0 +1,92 @@
+#ifndef OPTIMIZEDKIT_MEMORY_USAGE_HPP
+#define OPTIMIZEDKIT_MEMORY_USAGE_HPP
+
+#include <vector>
+#include <string>
+#include <unordered_map>
+#include <utility>
+#include <ostream>
+#include <cstddef>
+
+namespace OptimizedKit {
+    /**
+     * @brief Bytes allocated by the member arrays of a data structure, one entry per array.
+     *
+     * @details Arrays are accounted with their capacity, i.e. the memory they actually hold. Node based containers are
+     *          estimated by their bucket array and one value plus link pointer per node, the allocator overhead per
+     *          node is not known. Nested structures are flattened with their member name as prefix, e.g.
+     *          "upwardsGraph.head".
+     */
+    class MemoryUsage {
+    public:
+        /**
+         * @brief Records an allocation of the given size.
+         *
+         * @param name - The name of the array.
+         * @param bytes - The number of bytes allocated.
+         * @return Returns a reference to the memory usage.
+         */
+        MemoryUsage &add(std::string name, std::size_t bytes);
+
+        /**
+         * @brief Records the allocation of a vector.
+         *
+         * @tparam T - The element type.
+         * @tparam Allocator - The allocator type.
+         * @param name - The name of the vector.
+         * @param vector - The vector.
+         * @return Returns a reference to the memory usage.
+         */
+        template<typename T, typename Allocator>
+        MemoryUsage &add(std::string name, const std::vector<T, Allocator> &vector) {
+            return add(std::move(name), vector.capacity() * sizeof(T));
+        }
+
+        /**
+         * @brief Records the estimated allocation of a hash map.
+         *
+         * @tparam Key - The key type.
+         * @tparam Value - The mapped type.
+         * @param name - The name of the map.
+         * @param map - The map.
+         * @return Returns a reference to the memory usage.
+         */
+        template<typename Key, typename Value, typename Hash, typename Equal, typename Allocator>
+        MemoryUsage &add(std::string name, const std::unordered_map<Key, Value, Hash, Equal, Allocator> &map) {
+            return add(std::move(name), map.bucket_count() * sizeof(void *) +
+                                        map.size() * (sizeof(std::pair<const Key, Value>) + sizeof(void *)));
+        }
+
+        /**
+         * @brief Records the allocation of a bit vector, i.e. one bit per element.
+         */
+        MemoryUsage &add(std::string name, const std::vector<bool> &vector);
+
+        /**
+         * @brief Records all arrays of a nested structure with the given prefix.
+         */
+        MemoryUsage &add(const std::string &prefix, const MemoryUsage &nested);
+
+        /**
+         * @brief Total number of bytes of all recorded arrays.
+         */
+        [[nodiscard]] std::size_t totalBytes() const;
+
+        /**
+         * @brief Bytes recorded under the given name, zero if absent.
+         */
+        [[nodiscard]] std::size_t bytesOf(const std::string &name) const;
+
+        friend std::ostream &operator<<(std::ostream &stream, const MemoryUsage &usage);
+
+    // private:
+        std::vector<std::pair<std::string, std::size_t>> arrays;
+    };
+
+    /**
+     * @brief Prints one line per recorded array followed by the total.
+     */
+    std::ostream &operator<<(std::ostream &stream, const MemoryUsage &usage);
+}
+
+#endif //OPTIMIZEDKIT_MEMORY_USAGE_HPP
@@ -0,0 +1,45 @@
+#ifndef OPTIMIZEDKIT_NUMA_TOPOLOGY_HPP
+#define OPTIMIZEDKIT_NUMA_TOPOLOGY_HPP
+
+#include <vector>
+#include <string>
+
+namespace OptimizedKit {
+    /**
+     * @brief Parses a cpu list of the kernel, e.g. "0-3,8,10-11".
+     *
+     * @param cpuList - The cpu list.
+     * @return Returns the listed cpus in the order they are listed.
+     */
+    std::vector<unsigned> parseCpuList(const std::string &cpuList);
+
+    /**
+     * @brief The cpus of every NUMA node with cpus.
+     *
+     * @details Read from /sys/devices/system/node, systems without NUMA information are reported as a single node with
+     *          all cpus.
+     *
+     * @return Returns the cpus of every node, nodes without cpus are omitted.
+     */
+    std::vector<std::vector<unsigned>> numaNodeCpus();
+
+    /**
+     * @brief Restricts the calling thread to the given cpus.
+     *
+     * @details Memory touched first by the thread afterwards is placed on the NUMA node of these cpus by the default
+     *          memory policy of the kernel.
+     *
+     * @param cpus - The cpus the thread may run on.
+     * @return Returns true if the thread was pinned, false if pinning is not supported or failed.
+     */
+    bool pinCurrentThread(const std::vector<unsigned> &cpus);
+
+    /**
+     * @brief The cpu the calling thread currently runs on.
+     *
+     * @return Returns the cpu, or the largest unsigned value if unknown.
+     */
+    unsigned currentCpu();
+}
+
+#endif //OPTIMIZEDKIT_NUMA_TOPOLOGY_HPP
@@ -68,7 +68,7 @@ namespace OptimizedKit {
      * @param p - Permutation vector.
      * @param v - Vector to apply permutation to.
      */
-    void inplaceApplyPermutationToElementsOf(const std::vector<unsigned> &p, std::vector<unsigned> &v);
+    void inplaceApplyPermutationToElementsOf(const std::vector<VertexId> &p, std::vector<VertexId> &v);
 
     /**
      * @brief Applies a permutation to the elements of a vector. Meaning that the resulting vector is {p[v[0]], p[v[1]],
@@ -80,7 +80,7 @@ namespace OptimizedKit {
      * @param v - Value vector.
      * @return Returns vector resulting from applying permutation p to vector v.
      */
-    std::vector<unsigned> applyPermutationToElementsOf(const std::vector<unsigned> &p, const std::vector<unsigned> &v);
+    std::vector<VertexId> applyPermutationToElementsOf(const std::vector<VertexId> &p, const std::vector<VertexId> &v);
 
     /**
      * @brief Applies permutation p in inverse order to vector v resulting in {v[p^-1[n]], v[p^-1[n-1]], v[p^-1[n-2]],
@@ -121,8 +121,8 @@ namespace OptimizedKit {
      * @param q Permutation.
      * @return Returns the chained permutation.
      */
-    std::vector<unsigned>
-    chainPermutationFirstLeftThenRight(const std::vector<unsigned> &p, const std::vector<unsigned> &q);
+    std::vector<EdgeId>
+    chainPermutationFirstLeftThenRight(const std::vector<EdgeId> &p, const std::vector<EdgeId> &q);
 
     /**
      * @brief Compute the inverse sort permutation first by tail then by head and apply sort to tail.
@@ -133,7 +133,7 @@ namespace OptimizedKit {
      * @param head - head of the graph.
      * @return Returns the sorted permutation.
      */
-    std::vector<unsigned> computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(
+    std::vector<EdgeId> computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(
             std::vector<VertexId> &tail, const std::vector<VertexId> &head);
 
     /**
@@ -145,7 +145,7 @@ namespace OptimizedKit {
      * @param head - head of the graph.
      * @return Returns the sorted permutation.
      */
-    std::vector<unsigned>
+    std::vector<EdgeId>
     computeSortPermutationFirstByTailThenByHeadAndApplySortToTail(std::vector<VertexId> &tail,
                                                                   const std::vector<VertexId> &head);
 
@@ -159,7 +159,7 @@ namespace OptimizedKit {
      * @return Returns a vector containing per index its index, i.e. {0, 1, 2, ... , n-1}.
      */
     template<class P>
-    std::vector<P> identityPermutation(unsigned n);
+    std::vector<P> identityPermutation(std::size_t n);
 
     /**
      * @brief Computes a stable sort permutation using key.
@@ -171,7 +171,7 @@ namespace OptimizedKit {
      * @return Returns the stable sort permutation.
      */
     template<class V>
-    std::vector<unsigned> computeStableSortPermutation(const std::vector<V> &v);
+    std::vector<EdgeId> computeStableSortPermutation(const std::vector<V> &v);
 
     /**
      * @brief Computes an inverse stable sort permutation using key.
@@ -183,7 +183,7 @@ namespace OptimizedKit {
      * @return Returns the inverse stable sort permutation.
      */
     template<class V>
-    std::vector<unsigned> computeInverseStableSortPermutation(const std::vector<V> &v);
+    std::vector<EdgeId> computeInverseStableSortPermutation(const std::vector<V> &v);
 }
 
 #include "../../src/utils/permutation.tpp"
@@ -0,0 +1,79 @@
+#ifndef OPTIMIZEDKIT_TRACKING_OPERATOR_NEW_HPP
+#define OPTIMIZEDKIT_TRACKING_OPERATOR_NEW_HPP
+
+#include <cstdlib>
+#include <new>
+#include "utils/memory_tracker.hpp"
+
+/**
+ * @brief Replaces the global allocation functions to count every allocation in the memory tracker.
+ *
+ * @details Include in exactly one translation unit of an application, e.g. the one defining main, to record the peak
+ *          memory of each CCH preprocessing phase. Every allocation is prefixed with a header storing its size, which
+ *          is padded to the alignment of the allocation.
+ */
+namespace OptimizedKit::TrackingOperatorNew {
+    inline void *allocate(std::size_t bytes, std::size_t alignment) {
+        auto headerBytes = alignment < alignof(std::max_align_t) ? alignof(std::max_align_t) : alignment;
+        auto totalBytes = (headerBytes + bytes + alignment - 1) / alignment * alignment;
+        auto *memory = static_cast<char *>(std::aligned_alloc(alignment, totalBytes == 0 ? alignment : totalBytes));
+        if (memory == nullptr)
+            throw std::bad_alloc();
+        auto *pointer = memory + headerBytes;
+        reinterpret_cast<std::size_t *>(pointer)[-1] = bytes;
+        reinterpret_cast<std::size_t *>(pointer)[-2] = headerBytes;
+        MemoryTracker::recordAllocation(bytes);
+        return pointer;
+    }
+
+    inline void deallocate(void *pointer) noexcept {
+        if (pointer == nullptr)
+            return;
+        auto bytes = static_cast<std::size_t *>(pointer)[-1];
+        auto headerBytes = static_cast<std::size_t *>(pointer)[-2];
+        MemoryTracker::recordDeallocation(bytes);
+        std::free(static_cast<char *>(pointer) - headerBytes);
+    }
+}
+
+void *operator new(std::size_t bytes) {
+    return OptimizedKit::TrackingOperatorNew::allocate(bytes, alignof(std::max_align_t));
+}
+
+void *operator new[](std::size_t bytes) {
+    return OptimizedKit::TrackingOperatorNew::allocate(bytes, alignof(std::max_align_t));
+}
+
+void *operator new(std::size_t bytes, std::align_val_t alignment) {
+    return OptimizedKit::TrackingOperatorNew::allocate(bytes, static_cast<std::size_t>(alignment));
+}
+
+void *operator new[](std::size_t bytes, std::align_val_t alignment) {
+    return OptimizedKit::TrackingOperatorNew::allocate(bytes, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void *pointer) noexcept { OptimizedKit::TrackingOperatorNew::deallocate(pointer); }
+
+void operator delete[](void *pointer) noexcept { OptimizedKit::TrackingOperatorNew::deallocate(pointer); }
+
+void operator delete(void *pointer, std::size_t) noexcept { OptimizedKit::TrackingOperatorNew::deallocate(pointer); }
+
+void operator delete[](void *pointer, std::size_t) noexcept { OptimizedKit::TrackingOperatorNew::deallocate(pointer); }
+
+void operator delete(void *pointer, std::align_val_t) noexcept {
+    OptimizedKit::TrackingOperatorNew::deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::align_val_t) noexcept {
+    OptimizedKit::TrackingOperatorNew::deallocate(pointer);
+}
+
+void operator delete(void *pointer, std::size_t, std::align_val_t) noexcept {
+    OptimizedKit::TrackingOperatorNew::deallocate(pointer);
+}
+
+void operator delete[](void *pointer, std::size_t, std::align_val_t) noexcept {
+    OptimizedKit::TrackingOperatorNew::deallocate(pointer);
+}
+
+#endif //OPTIMIZEDKIT_TRACKING_OPERATOR_NEW_HPP
@@ -2,13 +2,26 @@
 #define OPTIMIZEDKIT_TYPES_HPP
 
 #include <vector>
+#include <cstdint>
 
 namespace OptimizedKit {
+    // Ids are 32-bit unless configured otherwise at build time, see the OPTIMIZEDKIT_64BIT_*_IDS options.
+#ifdef OPTIMIZEDKIT_64BIT_VERTEX_IDS
+    typedef std::uint64_t VertexId;
+#else
     typedef unsigned VertexId;
+#endif
+#ifdef OPTIMIZEDKIT_64BIT_EDGE_IDS
+    typedef std::uint64_t EdgeId;
+#else
     typedef unsigned EdgeId;
+#endif
+    static_assert(sizeof(EdgeId) >= sizeof(VertexId), "Edge ids must be at least as wide as vertex ids.");
+
     typedef std::vector<VertexId> Order;
     typedef std::vector<bool> Separator;
     typedef std::vector<VertexId> VertexMapping;
+    typedef std::vector<EdgeId> EdgeMapping;
     typedef std::vector<bool> Filter;
 }
 
@@ -28,7 +28,7 @@ namespace OptimizedKit {
      * @return Returns the maximum element of the vector.
      */
     template<typename V>
-    unsigned maxElementOfVector(const std::vector<V> &v) {
+    V maxElementOfVector(const std::vector<V> &v) {
         assert(!v.empty());
         return *std::max_element(v.begin(), v.end());
     }
@@ -44,7 +44,7 @@ namespace OptimizedKit {
      * @return Returns the inverse vector with the element count as the last element.
      */
     template<typename V>
-    std::vector<V> constructAdjacencyIndices(const std::vector<V> &v, unsigned edgeCount);
+    std::vector<EdgeId> constructAdjacencyIndices(const std::vector<V> &v, std::size_t edgeCount);
 
     /**
      * @brief Prints a vector to the console.
@@ -77,6 +77,19 @@ namespace OptimizedKit {
     template<typename T>
     void removeElementsByFilterInplace(std::vector<T> &vector, Filter filter);
 
+    /**
+     * @brief Removes whole lists from adjacency indices and their elements, the lists marked with true in the filter.
+     *
+     * @tparam I - Type of the adjacency indices.
+     * @tparam T - Type of the elements.
+     * @param adjacencyIndices - Start index of each list with the element count as the last entry.
+     * @param elements - Elements of all lists.
+     * @param filter - Filter indicating lists to remove.
+     */
+    template<typename I, typename T>
+    void removeAdjacencyListsByFilter(std::vector<I> &adjacencyIndices, std::vector<T> &elements,
+                                      const Filter &filter);
+
     /**
      * @brief Adjusts ids of elements in the vector that were marked in the filter to be left out.
      *
@@ -96,6 +109,15 @@ namespace OptimizedKit {
      */
     template <typename T>
     std::vector<T> readVectorFromBinaryFile(const std::string& filePath);
+
+    /**
+     * @brief Empties a vector and frees its memory, unlike clear which keeps the capacity.
+     *
+     * @tparam T - Type of the vector.
+     * @param vector - Vector to release.
+     */
+    template<typename T>
+    void releaseVector(std::vector<T> &vector);
 }
 
 #include "../../src/utils/vector_helper.tpp"
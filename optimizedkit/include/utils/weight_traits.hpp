@@ -0,0 +1,61 @@
+#ifndef OPTIMIZEDKIT_WEIGHT_TRAITS_HPP
+#define OPTIMIZEDKIT_WEIGHT_TRAITS_HPP
+
+#include <limits>
+#include <type_traits>
+
+namespace OptimizedKit {
+    /**
+     * @brief Compile-time arithmetic policy of a weight type, all relaxations go through it.
+     *
+     * @details Unsigned integral weights use half of their range as infinity, e.g. 2^31-1 for 32-bit and 2^15-1 for
+     *          16-bit weights, and signed integral weights their maximum, e.g. 2^31-1 for int. Sums are taken in the
+     *          unsigned type of the same width, so the sum of two weights never overflows before it is clamped. Floating
+     *          point weights use their native infinity, which IEEE addition already saturates to. The operations are
+     *          branch free so that loops over weight arrays can be vectorized. Other weight types specialize this
+     *          template next to their definition.
+     *
+     * @tparam WeightType - The type of the weights.
+     */
+    template<typename WeightType, typename = void>
+    struct WeightTraits;
+
+    template<typename WeightType>
+    struct WeightTraits<WeightType, std::enable_if_t<std::is_integral_v<WeightType>>> {
+        /**
+         * @brief The weight of absent and blocked arcs, larger than any finite weight.
+         */
+        static constexpr WeightType infinity() {
+            if constexpr (std::is_signed_v<WeightType>)
+                return std::numeric_limits<WeightType>::max();
+            else
+                return std::numeric_limits<WeightType>::max() >> 1;
+        }
+
+        /**
+         * @brief Adds two non-negative weights, sums reaching infinity are clamped to infinity.
+         */
+        static constexpr WeightType add(WeightType a, WeightType b) {
+            using UnsignedType = std::make_unsigned_t<WeightType>;
+            auto sum = static_cast<UnsignedType>(a) + static_cast<UnsignedType>(b);
+            return sum < static_cast<UnsignedType>(infinity()) ? static_cast<WeightType>(sum) : infinity();
+        }
+
+        static constexpr WeightType min(WeightType a, WeightType b) { return b < a ? b : a; }
+
+        static constexpr bool isInfinite(WeightType weight) { return !(weight < infinity()); }
+    };
+
+    template<typename WeightType>
+    struct WeightTraits<WeightType, std::enable_if_t<std::is_floating_point_v<WeightType>>> {
+        static constexpr WeightType infinity() { return std::numeric_limits<WeightType>::infinity(); }
+
+        static constexpr WeightType add(WeightType a, WeightType b) { return a + b; }
+
+        static constexpr WeightType min(WeightType a, WeightType b) { return b < a ? b : a; }
+
+        static constexpr bool isInfinite(WeightType weight) { return !(weight < infinity()); }
+    };
+}
+
+#endif //OPTIMIZEDKIT_WEIGHT_TRAITS_HPP
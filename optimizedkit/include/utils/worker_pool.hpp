@@ -0,0 +1,56 @@
+#ifndef OPTIMIZEDKIT_WORKER_POOL_HPP
+#define OPTIMIZEDKIT_WORKER_POOL_HPP
+
+#include <vector>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <functional>
+
+namespace OptimizedKit {
+    /**
+     * @brief A fixed set of worker threads that repeatedly run a task together with the calling thread.
+     *
+     * @details The threads are started once and sleep between tasks, hence running a task does not pay for creating
+     *          threads. Tasks of different callers are run one after another.
+     */
+    class WorkerPool {
+    public:
+        /**
+         * @brief Starts threadCount - 1 worker threads, the calling thread of run is the remaining one.
+         *
+         * @param threadCount - The number of threads running every task, at least 1.
+         */
+        explicit WorkerPool(unsigned threadCount);
+
+        ~WorkerPool();
+
+        WorkerPool(const WorkerPool &) = delete;
+
+        WorkerPool &operator=(const WorkerPool &) = delete;
+
+        [[nodiscard]] unsigned size() const { return workers.size() + 1; }
+
+        /**
+         * @brief Runs task(thread) on every thread of the pool and returns once all of them finished.
+         *
+         * @param task - The task, called with thread ids 0 to size() - 1 where 0 is the calling thread.
+         */
+        void run(const std::function<void(unsigned)> &task);
+
+    private:
+        void work(unsigned thread);
+
+        std::vector<std::thread> workers;
+        std::mutex runMutex;
+        std::mutex mutex;
+        std::condition_variable taskReady;
+        std::condition_variable taskDone;
+        const std::function<void(unsigned)> *currentTask = nullptr;
+        unsigned long long generation = 0;
+        unsigned pendingWorkers = 0;
+        bool stopping = false;
+    };
+}
+
+#endif //OPTIMIZEDKIT_WORKER_POOL_HPP
@@ -0,0 +1,233 @@
+#include <customizable_contraction_hierarchy/cch_core_query.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchCoreQuery<WeightType>::CchCoreQuery(const CchCoreReduction &reduction,
+                                                     const CchCustomizer<WeightType> &coreCustomizer,
+                                                     const std::vector<WeightType> &inputWeights, HeapType heapType)
+        : CchCoreQuery(reduction, coreCustomizer, inputWeights.data(), heapType) {}
+
+template<typename WeightType>
+OptimizedKit::CchCoreQuery<WeightType>::CchCoreQuery(const CchCoreReduction &reduction,
+                                                     const CchCustomizer<WeightType> &coreCustomizer,
+                                                     const WeightType *inputWeights, HeapType heapType)
+        : reduction(&reduction), inputWeights(inputWeights), coreQuery(coreCustomizer, heapType) {
+    assert(coreCustomizer.cchPreprocessor->cchVertexCount() == reduction.coreVertexCount() &&
+           "The customizer is not built on the core of the reduction.");
+}
+
+template<typename WeightType>
+OptimizedKit::CchCoreQuery<WeightType> &OptimizedKit::CchCoreQuery<WeightType>::run(VertexId source_, VertexId target_) {
+    assert(state == QueryState::INITIALIZED || state == QueryState::FINISHED);
+    assert(source_ < reduction->inputVertexCount() && "Source vertex id is out of bounds.");
+    assert(target_ < reduction->inputVertexCount() && "Target vertex id is out of bounds.");
+    const auto &r = *reduction;
+    source = source_;
+    target = target_;
+    sourceExits.clear();
+    targetExits.clear();
+    sharedTreeAncestor = INVALID_VALUE<VertexId>;
+    isOnSharedChain = false;
+    state = QueryState::FINISHED;
+
+    // Paths leaving a shared tree re-enter it through its anchor, which already lies on the path within the tree.
+    auto sourceAnchor = r.treeAnchor[source];
+    auto targetAnchor = r.treeAnchor[target];
+    if (sourceAnchor == targetAnchor) {
+        auto x = source, y = target;
+        while (r.treeDepth[x] > r.treeDepth[y])
+            x = r.treeParent[x];
+        while (r.treeDepth[y] > r.treeDepth[x])
+            y = r.treeParent[y];
+        while (x != y) {
+            x = r.treeParent[x];
+            y = r.treeParent[y];
+        }
+        sharedTreeAncestor = x;
+        queryWeight = Traits::add(treeWeight(source, x, true), treeWeight(target, x, false));
+        return *this;
+    }
+
+    // Anchors on the same chain may be connected along the chain without entering the core.
+    auto toSourceAnchor = treeWeight(source, sourceAnchor, true);
+    auto fromTargetAnchor = treeWeight(target, targetAnchor, false);
+    queryWeight = INFINITY_WEIGHT<WeightType>;
+    auto chain = r.chainOfVertex[sourceAnchor];
+    if (chain != INVALID_VALUE<VertexId> && chain == r.chainOfVertex[targetAnchor]) {
+        queryWeight = Traits::add(Traits::add(toSourceAnchor, chainWeight(r.chainPositionOfVertex[sourceAnchor],
+                                                                          r.chainPositionOfVertex[targetAnchor])),
+                                  fromTargetAnchor);
+        isOnSharedChain = !Traits::isInfinite(queryWeight);
+    }
+
+    // Search the core from every core vertex the source reaches to every core vertex reaching the target.
+    collectExits(sourceAnchor, toSourceAnchor, true, sourceExits);
+    collectExits(targetAnchor, fromTargetAnchor, false, targetExits);
+    if (sourceExits.empty() || targetExits.empty())
+        return *this;
+    if (r.isCoreVertex(source) && r.isCoreVertex(target)) {
+        coreQuery.run(r.coreVertexOfInputVertex[source], r.coreVertexOfInputVertex[target]);
+    } else {
+        std::vector<std::pair<VertexId, WeightType>> sources, targets;
+        for (const auto &exit: sourceExits)
+            sources.emplace_back(exit.coreVertex, exit.weight);
+        for (const auto &exit: targetExits)
+            targets.emplace_back(exit.coreVertex, exit.weight);
+        coreQuery.run(sources, targets);
+    }
+    if (coreQuery.getQueryWeight() < queryWeight) {
+        queryWeight = coreQuery.getQueryWeight();
+        isOnSharedChain = false;
+    }
+    return *this;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCoreQuery<WeightType>::getQueryWeight() {
+    assert(state == QueryState::FINISHED);
+    return queryWeight;
+}
+
+template<typename WeightType>
+std::vector<OptimizedKit::EdgeId> OptimizedKit::CchCoreQuery<WeightType>::getEdgePath() {
+    assert(state == QueryState::FINISHED);
+    const auto &r = *reduction;
+    std::vector<EdgeId> path;
+    if (Traits::isInfinite(queryWeight))
+        return path;
+    if (sharedTreeAncestor != INVALID_VALUE<VertexId>) {
+        appendTreePath(source, sharedTreeAncestor, true, path);
+        appendTreePath(target, sharedTreeAncestor, false, path);
+        return path;
+    }
+
+    auto sourceAnchor = r.treeAnchor[source];
+    auto targetAnchor = r.treeAnchor[target];
+    appendTreePath(source, sourceAnchor, true, path);
+    if (isOnSharedChain) {
+        appendChainPath(r.chainPositionOfVertex[sourceAnchor], r.chainPositionOfVertex[targetAnchor], path);
+    } else {
+        // The core search reports the core vertices its shortest path starts and ends at.
+        auto exitTo = [](const std::vector<CchCoreExit<WeightType>> &exits, VertexId coreVertex) {
+            return *std::find_if(exits.begin(), exits.end(), [&](const auto &exit) {
+                return exits.size() == 1 || exit.coreVertex == coreVertex;
+            });
+        };
+        auto sourceExit = exitTo(sourceExits, coreQuery.getSource());
+        auto targetExit = exitTo(targetExits, coreQuery.getTarget());
+        if (sourceExit.chainPosition != INVALID_VALUE<EdgeId>)
+            appendChainPath(r.chainPositionOfVertex[sourceAnchor], sourceExit.chainPosition, path);
+        appendCorePath(path);
+        if (targetExit.chainPosition != INVALID_VALUE<EdgeId>)
+            appendChainPath(targetExit.chainPosition, r.chainPositionOfVertex[targetAnchor], path);
+    }
+    appendTreePath(target, targetAnchor, false, path);
+    return path;
+}
+
+template<typename WeightType>
+std::vector<OptimizedKit::VertexId> OptimizedKit::CchCoreQuery<WeightType>::getVertexPath() {
+    auto edgePath = getEdgePath();
+    std::vector<VertexId> vertexPath;
+    if (Traits::isInfinite(queryWeight))
+        return vertexPath;
+    vertexPath.push_back(source);
+    for (auto edge: edgePath)
+        vertexPath.push_back(reduction->inputHead[edge]);
+    return vertexPath;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCoreQuery<WeightType>::hopWeight(EdgeId hop, bool forward) const {
+    auto edge = reduction->bestHopEdge(hop, forward, inputWeights);
+    return edge == INVALID_VALUE<EdgeId> ? INFINITY_WEIGHT<WeightType> : inputWeights[edge];
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCoreQuery<WeightType>::treeWeight(VertexId x, VertexId ancestor, bool upwards) const {
+    WeightType weight{};
+    for (; x != ancestor; x = reduction->treeParent[x])
+        weight = Traits::add(weight, hopWeight(reduction->treeParentHop[x], upwards));
+    return weight;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCoreQuery<WeightType>::chainWeight(EdgeId fromPosition, EdgeId toPosition) const {
+    WeightType weight{};
+    for (auto position = fromPosition; position < toPosition; ++position)
+        weight = Traits::add(weight, hopWeight(reduction->hopAfterChainPosition[position], true));
+    for (auto position = toPosition; position < fromPosition; ++position)
+        weight = Traits::add(weight, hopWeight(reduction->hopAfterChainPosition[position], false));
+    return weight;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCoreQuery<WeightType>::collectExits(VertexId anchor, WeightType treeWalkWeight, bool forward,
+                                                          std::vector<CchCoreExit<WeightType>> &exits) const {
+    const auto &r = *reduction;
+    if (Traits::isInfinite(treeWalkWeight))
+        return;
+    if (r.isCoreVertex(anchor)) {
+        exits.push_back({r.coreVertexOfInputVertex[anchor], treeWalkWeight, INVALID_VALUE<EdgeId>});
+        return;
+    }
+
+    // Both ends of the chain, the ends of a cycle coincide and only the cheaper walk is kept.
+    auto chain = r.chainOfVertex[anchor];
+    auto position = r.chainPositionOfVertex[anchor];
+    for (auto end: {r.chainVertexIndices[chain], r.chainVertexIndices[chain + 1] - 1}) {
+        auto weight = Traits::add(treeWalkWeight, forward ? chainWeight(position, end) : chainWeight(end, position));
+        if (Traits::isInfinite(weight))
+            continue;
+        CchCoreExit<WeightType> exit{r.coreVertexOfInputVertex[r.chainVertices[end]], weight, end};
+        if (!exits.empty() && exits.back().coreVertex == exit.coreVertex) {
+            if (exit.weight < exits.back().weight)
+                exits.back() = exit;
+            continue;
+        }
+        exits.push_back(exit);
+    }
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCoreQuery<WeightType>::appendHop(EdgeId hop, bool forward, std::vector<EdgeId> &path) const {
+    auto edge = reduction->bestHopEdge(hop, forward, inputWeights);
+    assert(edge != INVALID_VALUE<EdgeId>);
+    path.push_back(edge);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCoreQuery<WeightType>::appendTreePath(VertexId x, VertexId ancestor, bool upwards,
+                                                            std::vector<EdgeId> &path) const {
+    // Downwards paths are collected from the bottom and reversed.
+    auto begin = path.size();
+    for (; x != ancestor; x = reduction->treeParent[x])
+        appendHop(reduction->treeParentHop[x], upwards, path);
+    if (!upwards)
+        std::reverse(path.begin() + begin, path.end());
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCoreQuery<WeightType>::appendChainPath(EdgeId fromPosition, EdgeId toPosition,
+                                                             std::vector<EdgeId> &path) const {
+    for (auto position = fromPosition; position < toPosition; ++position)
+        appendHop(reduction->hopAfterChainPosition[position], true, path);
+    for (auto position = fromPosition; position > toPosition; --position)
+        appendHop(reduction->hopAfterChainPosition[position - 1], false, path);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCoreQuery<WeightType>::appendCorePath(std::vector<EdgeId> &path) {
+    const auto &r = *reduction;
+    for (auto coreEdge: coreQuery.getEdgePath()) {
+        if (r.inputEdgeOfCoreEdge[coreEdge] != INVALID_VALUE<EdgeId>) {
+            path.push_back(r.inputEdgeOfCoreEdge[coreEdge]);
+            continue;
+        }
+        auto chain = r.chainOfCoreEdge[coreEdge];
+        auto first = r.chainVertexIndices[chain], last = r.chainVertexIndices[chain + 1] - 1;
+        if (r.isCoreEdgeBackwards[coreEdge])
+            appendChainPath(last, first, path);
+        else
+            appendChainPath(first, last, path);
+    }
+}
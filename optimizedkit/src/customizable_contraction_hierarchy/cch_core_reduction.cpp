@@ -0,0 +1,261 @@
+#include <customizable_contraction_hierarchy/cch_core_reduction.hpp>
+
+OptimizedKit::CchCoreReduction::CchCoreReduction(const Graph &graph) {
+    inputTail = graph.tail;
+    inputHead = graph.head;
+    const VertexId vertexCount = graph.vertexCount;
+    assert(std::all_of(inputTail.begin(), inputTail.end(), [&](VertexId x) { return x < vertexCount; }));
+    assert(std::all_of(inputHead.begin(), inputHead.end(), [&](VertexId x) { return x < vertexCount; }));
+
+    // Incident edges of every vertex regardless of direction, loops are incident once.
+    std::vector<EdgeId> incidenceIndices(vertexCount + 1, 0);
+    for (EdgeId edge = 0; edge < inputTail.size(); ++edge) {
+        ++incidenceIndices[inputTail[edge] + 1];
+        if (inputHead[edge] != inputTail[edge])
+            ++incidenceIndices[inputHead[edge] + 1];
+    }
+    for (VertexId x = 0; x < vertexCount; ++x)
+        incidenceIndices[x + 1] += incidenceIndices[x];
+    std::vector<EdgeId> incidentEdges(incidenceIndices.back());
+    {
+        auto next = incidenceIndices;
+        for (EdgeId edge = 0; edge < inputTail.size(); ++edge) {
+            incidentEdges[next[inputTail[edge]]++] = edge;
+            if (inputHead[edge] != inputTail[edge])
+                incidentEdges[next[inputHead[edge]]++] = edge;
+        }
+    }
+
+    // Number of distinct neighbours of every vertex, loops and parallel edges do not count.
+    std::vector<VertexId> degree(vertexCount, 0);
+    {
+        std::vector<VertexId> lastSeenBy(vertexCount, INVALID_VALUE<VertexId>);
+        for (VertexId x = 0; x < vertexCount; ++x) {
+            for (EdgeId i = incidenceIndices[x]; i < incidenceIndices[x + 1]; ++i) {
+                auto y = otherEnd(incidentEdges[i], x);
+                if (y != x && lastSeenBy[y] != x) {
+                    lastSeenBy[y] = x;
+                    ++degree[x];
+                }
+            }
+        }
+    }
+
+    peelTrees(incidenceIndices, incidentEdges, degree);
+    collapseChains(incidenceIndices, incidentEdges, degree);
+    buildCoreGraph();
+}
+
+void OptimizedKit::CchCoreReduction::peelTrees(const std::vector<EdgeId> &incidenceIndices,
+                                               const std::vector<EdgeId> &incidentEdges,
+                                               std::vector<VertexId> &degree) {
+    const VertexId vertexCount = degree.size();
+    treeParent.assign(vertexCount, INVALID_VALUE<VertexId>);
+    treeParentHop.assign(vertexCount, INVALID_VALUE<EdgeId>);
+    treeDepth.assign(vertexCount, 0);
+    treeAnchor.resize(vertexCount);
+    for (VertexId x = 0; x < vertexCount; ++x)
+        treeAnchor[x] = x;
+
+    // Repeatedly remove vertices with a single remaining neighbour, the last vertex of a tree component remains.
+    std::vector<VertexId> peelable;
+    std::vector<VertexId> peelOrder;
+    for (VertexId x = 0; x < vertexCount; ++x)
+        if (degree[x] == 1)
+            peelable.push_back(x);
+    while (!peelable.empty()) {
+        auto x = peelable.back();
+        peelable.pop_back();
+        if (degree[x] != 1 || treeParent[x] != INVALID_VALUE<VertexId>)
+            continue;
+        for (EdgeId i = incidenceIndices[x]; i < incidenceIndices[x + 1]; ++i) {
+            auto y = otherEnd(incidentEdges[i], x);
+            if (y != x && treeParent[y] == INVALID_VALUE<VertexId>) {
+                treeParent[x] = y;
+                break;
+            }
+        }
+        assert(treeParent[x] != INVALID_VALUE<VertexId>);
+        degree[x] = 0;
+        peelOrder.push_back(x);
+        if (--degree[treeParent[x]] == 1)
+            peelable.push_back(treeParent[x]);
+    }
+
+    // Parents are peeled after their children, hence anchors and depths follow in reverse peel order.
+    for (auto it = peelOrder.rbegin(); it != peelOrder.rend(); ++it) {
+        auto x = *it;
+        auto parent = treeParent[x];
+        treeAnchor[x] = treeAnchor[parent];
+        treeDepth[x] = treeDepth[parent] + 1;
+        treeParentHop[x] = addHop(x, parent, incidenceIndices, incidentEdges);
+    }
+}
+
+void OptimizedKit::CchCoreReduction::collapseChains(const std::vector<EdgeId> &incidenceIndices,
+                                                    const std::vector<EdgeId> &incidentEdges,
+                                                    const std::vector<VertexId> &degree) {
+    const VertexId vertexCount = degree.size();
+    chainOfVertex.assign(vertexCount, INVALID_VALUE<VertexId>);
+    chainPositionOfVertex.assign(vertexCount, INVALID_VALUE<EdgeId>);
+    chainVertexIndices.assign(1, 0);
+    chainVertices.clear();
+    hopAfterChainPosition.clear();
+
+    // Remaining neighbours of a chain vertex other than the given one, peeled vertices have a parent.
+    auto isRemaining = [&](VertexId x) { return treeParent[x] == INVALID_VALUE<VertexId>; };
+    auto nextOnChain = [&](VertexId x, VertexId previous) {
+        for (EdgeId i = incidenceIndices[x]; i < incidenceIndices[x + 1]; ++i) {
+            auto y = otherEnd(incidentEdges[i], x);
+            if (y != x && y != previous && isRemaining(y))
+                return y;
+        }
+        return INVALID_VALUE<VertexId>;
+    };
+
+    // Walks away from x until the first vertex with another degree or x itself, both are included.
+    auto walk = [&](VertexId x, VertexId y) {
+        std::vector<VertexId> path{y};
+        VertexId previous = x;
+        while (y != x && degree[y] == 2) {
+            auto next = nextOnChain(y, previous);
+            previous = y;
+            y = next;
+            path.push_back(y);
+        }
+        return path;
+    };
+
+    for (VertexId x = 0; x < vertexCount; ++x) {
+        if (!isRemaining(x) || degree[x] != 2 || chainOfVertex[x] != INVALID_VALUE<VertexId>)
+            continue;
+        auto first = nextOnChain(x, INVALID_VALUE<VertexId>);
+        auto second = nextOnChain(x, first);
+        auto left = walk(x, first);
+
+        // A cycle of chain vertices keeps x in the core and runs from x around to x.
+        std::vector<VertexId> chain;
+        if (left.back() == x) {
+            chain.push_back(x);
+            chain.insert(chain.end(), left.begin(), left.end());
+        } else {
+            auto right = walk(x, second);
+            chain.assign(left.rbegin(), left.rend());
+            chain.push_back(x);
+            chain.insert(chain.end(), right.begin(), right.end());
+        }
+
+        VertexId chainId = chainVertexIndices.size() - 1;
+        for (std::size_t i = 0; i < chain.size(); ++i) {
+            if (i != 0 && i + 1 != chain.size()) {
+                chainOfVertex[chain[i]] = chainId;
+                chainPositionOfVertex[chain[i]] = chainVertices.size();
+            }
+            chainVertices.push_back(chain[i]);
+            hopAfterChainPosition.push_back(i + 1 == chain.size() ? INVALID_VALUE<EdgeId> :
+                                            addHop(chain[i], chain[i + 1], incidenceIndices, incidentEdges));
+        }
+        chainVertexIndices.push_back(chainVertices.size());
+    }
+}
+
+void OptimizedKit::CchCoreReduction::buildCoreGraph() {
+    coreVertexOfInputVertex.assign(treeParent.size(), INVALID_VALUE<VertexId>);
+    inputVertexOfCoreVertex.clear();
+    for (VertexId x = 0; x < inputVertexCount(); ++x) {
+        if (treeParent[x] == INVALID_VALUE<VertexId> && chainOfVertex[x] == INVALID_VALUE<VertexId>) {
+            coreVertexOfInputVertex[x] = inputVertexOfCoreVertex.size();
+            inputVertexOfCoreVertex.push_back(x);
+        }
+    }
+
+    // Input edges between core vertices are kept as they are.
+    coreGraph = Graph();
+    coreGraph.vertexCount = coreVertexCount();
+    inputEdgeOfCoreEdge.clear();
+    chainOfCoreEdge.clear();
+    isCoreEdgeBackwards.clear();
+    auto addCoreEdge = [&](VertexId x, VertexId y, EdgeId inputEdge, VertexId chain, bool backwards) {
+        coreGraph.addEdge(coreVertexOfInputVertex[x], coreVertexOfInputVertex[y]);
+        inputEdgeOfCoreEdge.push_back(inputEdge);
+        chainOfCoreEdge.push_back(chain);
+        isCoreEdgeBackwards.push_back(backwards);
+    };
+    for (EdgeId edge = 0; edge < inputTail.size(); ++edge)
+        if (isCoreVertex(inputTail[edge]) && isCoreVertex(inputHead[edge]))
+            addCoreEdge(inputTail[edge], inputHead[edge], edge, INVALID_VALUE<VertexId>, false);
+
+    // A chain contributes an edge in every direction all of its hops can be travelled in, loops are never needed.
+    for (VertexId chain = 0; chain + 1 < chainVertexIndices.size(); ++chain) {
+        auto begin = chainVertexIndices[chain], end = chainVertexIndices[chain + 1];
+        if (chainVertices[begin] == chainVertices[end - 1])
+            continue;
+        bool isForward = true, isBackward = true;
+        for (auto position = begin; position + 1 < end; ++position) {
+            auto hop = hopAfterChainPosition[position];
+            bool hasForward = false, hasBackward = false;
+            for (auto i = hopEdgeIndices[hop]; i < hopEdgeIndices[hop + 1]; ++i)
+                (inputTail[hopEdges[i]] == hopTail[hop] ? hasForward : hasBackward) = true;
+            isForward = isForward && hasForward;
+            isBackward = isBackward && hasBackward;
+        }
+        if (isForward)
+            addCoreEdge(chainVertices[begin], chainVertices[end - 1], INVALID_VALUE<EdgeId>, chain, false);
+        if (isBackward)
+            addCoreEdge(chainVertices[end - 1], chainVertices[begin], INVALID_VALUE<EdgeId>, chain, true);
+    }
+}
+
+OptimizedKit::EdgeId OptimizedKit::CchCoreReduction::addHop(VertexId from, VertexId to,
+                                                            const std::vector<EdgeId> &incidenceIndices,
+                                                            const std::vector<EdgeId> &incidentEdges) {
+    if (hopEdgeIndices.empty())
+        hopEdgeIndices.push_back(0);
+
+    // Scan the vertex with fewer incident edges, chain ends may be core vertices of high degree.
+    auto x = incidenceIndices[from + 1] - incidenceIndices[from] <= incidenceIndices[to + 1] - incidenceIndices[to] ?
+             from : to;
+    for (EdgeId i = incidenceIndices[x]; i < incidenceIndices[x + 1]; ++i) {
+        auto edge = incidentEdges[i];
+        if ((inputTail[edge] == from && inputHead[edge] == to) || (inputTail[edge] == to && inputHead[edge] == from))
+            hopEdges.push_back(edge);
+    }
+    hopTail.push_back(from);
+    hopEdgeIndices.push_back(hopEdges.size());
+    return hopTail.size() - 1;
+}
+
+OptimizedKit::Order OptimizedKit::CchCoreReduction::reduceOrder(const Order &inputOrder) const {
+    assert(inputOrder.size() == inputVertexCount());
+    Order coreOrder;
+    coreOrder.reserve(coreVertexCount());
+    for (auto x: inputOrder)
+        if (isCoreVertex(x))
+            coreOrder.push_back(coreVertexOfInputVertex[x]);
+    return coreOrder;
+}
+
+OptimizedKit::MemoryUsage OptimizedKit::CchCoreReduction::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("inputTail", inputTail)
+         .add("inputHead", inputHead)
+         .add("coreGraph", coreGraph.memoryUsage())
+         .add("coreVertexOfInputVertex", coreVertexOfInputVertex)
+         .add("inputVertexOfCoreVertex", inputVertexOfCoreVertex)
+         .add("inputEdgeOfCoreEdge", inputEdgeOfCoreEdge)
+         .add("chainOfCoreEdge", chainOfCoreEdge)
+         .add("isCoreEdgeBackwards", isCoreEdgeBackwards)
+         .add("hopTail", hopTail)
+         .add("hopEdgeIndices", hopEdgeIndices)
+         .add("hopEdges", hopEdges);
+    usage.add("treeParent", treeParent)
+         .add("treeParentHop", treeParentHop)
+         .add("treeAnchor", treeAnchor)
+         .add("treeDepth", treeDepth)
+         .add("chainOfVertex", chainOfVertex)
+         .add("chainPositionOfVertex", chainPositionOfVertex)
+         .add("chainVertexIndices", chainVertexIndices)
+         .add("chainVertices", chainVertices)
+         .add("hopAfterChainPosition", hopAfterChainPosition);
+    return usage;
+}
@@ -0,0 +1,35 @@
+#include <customizable_contraction_hierarchy/cch_core_reduction.hpp>
+
+template<typename WeightType>
+std::vector<WeightType> OptimizedKit::CchCoreReduction::reduceWeights(const WeightType *inputWeights) const {
+    using Traits = WeightTraits<WeightType>;
+    std::vector<WeightType> coreWeights(coreGraph.getEdgeCount());
+    for (EdgeId coreEdge = 0; coreEdge < coreGraph.getEdgeCount(); ++coreEdge) {
+        if (inputEdgeOfCoreEdge[coreEdge] != INVALID_VALUE<EdgeId>) {
+            coreWeights[coreEdge] = inputWeights[inputEdgeOfCoreEdge[coreEdge]];
+            continue;
+        }
+
+        // Chains exist in a direction only if every hop has an input edge in it.
+        auto chain = chainOfCoreEdge[coreEdge];
+        bool forward = !isCoreEdgeBackwards[coreEdge];
+        WeightType weight{};
+        for (auto position = chainVertexIndices[chain]; position + 1 < chainVertexIndices[chain + 1]; ++position)
+            weight = Traits::add(weight, inputWeights[bestHopEdge(hopAfterChainPosition[position], forward, inputWeights)]);
+        coreWeights[coreEdge] = weight;
+    }
+    return coreWeights;
+}
+
+template<typename WeightType>
+OptimizedKit::EdgeId
+OptimizedKit::CchCoreReduction::bestHopEdge(EdgeId hop, bool forward, const WeightType *inputWeights) const {
+    EdgeId best = INVALID_VALUE<EdgeId>;
+    for (auto i = hopEdgeIndices[hop]; i < hopEdgeIndices[hop + 1]; ++i) {
+        auto edge = hopEdges[i];
+        if ((inputTail[edge] == hopTail[hop]) == forward &&
+            (best == INVALID_VALUE<EdgeId> || inputWeights[edge] < inputWeights[best]))
+            best = edge;
+    }
+    return best;
+}
@@ -32,7 +32,12 @@ OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>
     }
     inputWeights = weights;
     cchPreprocessor = &preprocessor;
+    attributeCount = 0;
+    inputAttributes.clear();
+    forwardAttributes.clear();
+    backwardAttributes.clear();
     state = CustomizerState::UNCUSTOMIZED;
+    ++metricVersion;
     return *this;
 }
 
@@ -48,6 +53,7 @@ template<typename WeightType>
 OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::reset(const WeightType *weights) {
     inputWeights = weights;
     state = CustomizerState::UNCUSTOMIZED;
+    ++metricVersion;
     return *this;
 }
 
@@ -60,53 +66,308 @@ OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>
 
 template<typename WeightType>
 void OptimizedKit::CchCustomizer<WeightType>::extractEdgeWeight(EdgeId edge){
-    // Check if edge is a shortcut edge.
-    if(!cchPreprocessor->doesCchEdgeHaveInputEdge[edge]) {
-        forwardWeights[edge] = INFINITY_WEIGHT<WeightType>;
-        backwardWeights[edge] = INFINITY_WEIGHT<WeightType>;
-        return;
-    }
-
     // Extract weights based on existence as input edges.
-    auto localId = cchPreprocessor->doesCchEdgeHaveInputEdgeMapper.toLocal(edge);
-    auto forwardEdgeId = cchPreprocessor->forwardInputEdgeOfCchEdge[localId];
+    auto forwardEdgeId = cchPreprocessor->forwardGatherInputEdge[edge];
     forwardWeights[edge] = forwardEdgeId == INVALID_VALUE < EdgeId > ? INFINITY_WEIGHT < WeightType > : inputWeights[forwardEdgeId];
-    auto backwardEdgeId = cchPreprocessor->backwardInputEdgeOfCchEdge[localId];
+    auto backwardEdgeId = cchPreprocessor->backwardGatherInputEdge[edge];
     backwardWeights[edge] = backwardEdgeId == INVALID_VALUE < EdgeId > ? INFINITY_WEIGHT < WeightType > : inputWeights[backwardEdgeId];
+    if(attributeCount != 0){
+        setAttributes(&forwardAttributes[edge * attributeCount], forwardEdgeId == INVALID_VALUE<EdgeId> ? nullptr : &inputAttributes[forwardEdgeId * attributeCount]);
+        setAttributes(&backwardAttributes[edge * attributeCount], backwardEdgeId == INVALID_VALUE<EdgeId> ? nullptr : &inputAttributes[backwardEdgeId * attributeCount]);
+    }
 
     // Check if extra input edges exist.
     if(!cchPreprocessor->doesCchEdgeHaveExtraInputEdge[edge])
         return;
 
     // Minimize edge distance based on all input edges.
-    localId = cchPreprocessor->doesCchEdgeHaveExtraInputEdgeMapper.toLocal(edge);
+    auto localId = cchPreprocessor->doesCchEdgeHaveExtraInputEdge.rank(edge);
     for(auto extraId = cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[localId];
-        extraId < cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId)
-        updateIfSmaller(forwardWeights[edge], inputWeights[cchPreprocessor->extraForwardInputEdgeOfCch[extraId]]);
+        extraId < cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId){
+        auto inputEdge = cchPreprocessor->extraForwardInputEdgeOfCch[extraId];
+        if(attributeCount == 0)
+            updateIfSmaller(forwardWeights[edge], inputWeights[inputEdge]);
+        else
+            relaxAttributed(forwardWeights[edge], &forwardAttributes[edge * attributeCount], inputWeights[inputEdge],
+                            &inputAttributes[inputEdge * attributeCount]);
+    }
     for(auto extraId = cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[localId];
-        extraId < cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId)
-        updateIfSmaller(backwardWeights[edge], inputWeights[cchPreprocessor->extraBackwardInputEdgeOfCch[extraId]]);
+        extraId < cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId){
+        auto inputEdge = cchPreprocessor->extraBackwardInputEdgeOfCch[extraId];
+        if(attributeCount == 0)
+            updateIfSmaller(backwardWeights[edge], inputWeights[inputEdge]);
+        else
+            relaxAttributed(backwardWeights[edge], &backwardAttributes[edge * attributeCount], inputWeights[inputEdge],
+                            &inputAttributes[inputEdge * attributeCount]);
+    }
+}
+
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &
+OptimizedKit::CchCustomizer<WeightType>::setSecondaryAttributes(const std::vector<std::vector<WeightType>> &attributes) {
+    auto inputEdgeCount = cchPreprocessor->inputGraph.getEdgeCount();
+    attributeCount = static_cast<unsigned>(attributes.size());
+    inputAttributes.resize(static_cast<std::size_t>(inputEdgeCount) * attributeCount);
+    for(unsigned k = 0; k < attributeCount; ++k){
+        if(attributes[k].size() != inputEdgeCount)
+            throw std::invalid_argument("A secondary attribute needs a value for every input edge.");
+        for(EdgeId edge = 0; edge < inputEdgeCount; ++edge)
+            inputAttributes[edge * attributeCount + k] = attributes[k][edge];
+    }
+    forwardAttributes.clear();
+    backwardAttributes.clear();
+    state = CustomizerState::UNCUSTOMIZED;
+    ++metricVersion;
+    return *this;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::setAttributes(WeightType *attributes, const WeightType *inputEdgeAttributes) {
+    for(unsigned k = 0; k < attributeCount; ++k)
+        attributes[k] = inputEdgeAttributes == nullptr ? WeightType{} : inputEdgeAttributes[k];
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::relaxAttributed(WeightType &weight, WeightType *attributes,
+                                                              WeightType candidate, const WeightType *firstAttributes,
+                                                              const WeightType *secondAttributes) {
+    auto candidateAttribute = [&](unsigned k){
+        return secondAttributes == nullptr ? firstAttributes[k] : firstAttributes[k] + secondAttributes[k];
+    };
+    if(!(candidate < weight)){
+        // Equally short finite candidates only win with lexicographically smaller attributes, independent of the order
+        // candidates are relaxed in.
+        if(candidate != weight || Traits::isInfinite(candidate))
+            return;
+        unsigned k = 0;
+        while(k < attributeCount && candidateAttribute(k) == attributes[k])
+            ++k;
+        if(k == attributeCount || attributes[k] < candidateAttribute(k))
+            return;
+    }
+    weight = candidate;
+    for(unsigned k = 0; k < attributeCount; ++k)
+        attributes[k] = candidateAttribute(k);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::gatherRespectingMetric(EdgeId begin, EdgeId end) {
+    const auto *forwardGather = cchPreprocessor->forwardGatherInputEdge.data();
+    const auto *backwardGather = cchPreprocessor->backwardGatherInputEdge.data();
+    for(EdgeId edge = begin; edge < end; ++edge){
+        forwardWeights[edge] = forwardGather[edge] == INVALID_VALUE<EdgeId> ? INFINITY_WEIGHT<WeightType> : inputWeights[forwardGather[edge]];
+        backwardWeights[edge] = backwardGather[edge] == INVALID_VALUE<EdgeId> ? INFINITY_WEIGHT<WeightType> : inputWeights[backwardGather[edge]];
+    }
 }
 
 template<typename WeightType>
 void OptimizedKit::CchCustomizer<WeightType>::extractRespectingMetric() {
-    for (EdgeId edge = 0; edge < cchPreprocessor->cchEdgeCount(); ++edge)
-        extractEdgeWeight(edge);
+    // Gather the single input edge of each cch edge, split into contiguous blocks if running in parallel.
+    EdgeId edgeCount = cchPreprocessor->cchEdgeCount();
+    if(updateMode == UpdateMode::PARALLEL && threadCount > 1 && edgeCount >= threadCount * PARALLEL_GATHER_BLOCK_SIZE){
+        EdgeId blockSize = (edgeCount + threadCount - 1) / threadCount;
+        workerPool->run([this, blockSize, edgeCount](unsigned thread){
+            gatherRespectingMetric(std::min(edgeCount, thread * blockSize), std::min(edgeCount, (thread + 1) * blockSize));
+        });
+    } else {
+        gatherRespectingMetric(0, edgeCount);
+    }
+
+    // Minimize over parallel input edges mapped to the same cch edge.
+    if(attributeCount != 0){
+        extractAttributes();
+        return;
+    }
+    for(std::size_t i = 0; i < cchPreprocessor->forwardReductionCchEdge.size(); ++i)
+        updateIfSmaller(forwardWeights[cchPreprocessor->forwardReductionCchEdge[i]], inputWeights[cchPreprocessor->forwardReductionInputEdge[i]]);
+    for(std::size_t i = 0; i < cchPreprocessor->backwardReductionCchEdge.size(); ++i)
+        updateIfSmaller(backwardWeights[cchPreprocessor->backwardReductionCchEdge[i]], inputWeights[cchPreprocessor->backwardReductionInputEdge[i]]);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::extractAttributes() {
+    // Gather the attributes of the gathered input edges, then minimize over parallel input edges with attributes.
+    const auto &forwardGather = cchPreprocessor->forwardGatherInputEdge;
+    const auto &backwardGather = cchPreprocessor->backwardGatherInputEdge;
+    forwardAttributes.resize(static_cast<std::size_t>(cchPreprocessor->cchEdgeCount()) * attributeCount);
+    backwardAttributes.resize(static_cast<std::size_t>(cchPreprocessor->cchEdgeCount()) * attributeCount);
+    for(EdgeId edge = 0; edge < cchPreprocessor->cchEdgeCount(); ++edge){
+        setAttributes(&forwardAttributes[edge * attributeCount], forwardGather[edge] == INVALID_VALUE<EdgeId> ? nullptr : &inputAttributes[forwardGather[edge] * attributeCount]);
+        setAttributes(&backwardAttributes[edge * attributeCount], backwardGather[edge] == INVALID_VALUE<EdgeId> ? nullptr : &inputAttributes[backwardGather[edge] * attributeCount]);
+    }
+    for(std::size_t i = 0; i < cchPreprocessor->forwardReductionCchEdge.size(); ++i){
+        auto edge = cchPreprocessor->forwardReductionCchEdge[i];
+        auto inputEdge = cchPreprocessor->forwardReductionInputEdge[i];
+        relaxAttributed(forwardWeights[edge], &forwardAttributes[edge * attributeCount], inputWeights[inputEdge],
+                        &inputAttributes[inputEdge * attributeCount]);
+    }
+    for(std::size_t i = 0; i < cchPreprocessor->backwardReductionCchEdge.size(); ++i){
+        auto edge = cchPreprocessor->backwardReductionCchEdge[i];
+        auto inputEdge = cchPreprocessor->backwardReductionInputEdge[i];
+        relaxAttributed(backwardWeights[edge], &backwardAttributes[edge * attributeCount], inputWeights[inputEdge],
+                        &inputAttributes[inputEdge * attributeCount]);
+    }
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::refreshReachability() {
+    // The components only depend on which input arcs are blocked, so an unchanged blocked set keeps them valid.
+    const auto &inputEdgeTail = cchPreprocessor->inputEdgeTail;
+    const auto &inputEdgeHead = cchPreprocessor->inputEdgeHead;
+    std::vector<EdgeId> blocked;
+    for(EdgeId inputEdge = 0; inputEdge < inputEdgeTail.size(); ++inputEdge)
+        if(Traits::isInfinite(inputWeights[inputEdge]))
+            blocked.push_back(inputEdge);
+    if(blocked == blockedInputEdges && stronglyConnectedComponent.size() == cchPreprocessor->cchVertexCount())
+        return;
+    blockedInputEdges = std::move(blocked);
+
+    // Without blocked arcs the metric has the same components as the topology.
+    if(blockedInputEdges.empty() && !cchPreprocessor->stronglyConnectedComponent.empty()){
+        stronglyConnectedComponent = cchPreprocessor->stronglyConnectedComponent;
+        weaklyConnectedComponent = cchPreprocessor->weaklyConnectedComponent;
+        return;
+    }
+
+    std::vector<VertexId> tail;
+    std::vector<VertexId> head;
+    tail.reserve(inputEdgeTail.size() - blockedInputEdges.size());
+    head.reserve(inputEdgeTail.size() - blockedInputEdges.size());
+    for(EdgeId inputEdge = 0; inputEdge < inputEdgeTail.size(); ++inputEdge){
+        if(!Traits::isInfinite(inputWeights[inputEdge])){
+            tail.push_back(inputEdgeTail[inputEdge]);
+            head.push_back(inputEdgeHead[inputEdge]);
+        }
+    }
+    stronglyConnectedComponent = computeStronglyConnectedComponents(cchPreprocessor->cchVertexCount(), tail, head);
+    weaklyConnectedComponent = computeWeaklyConnectedComponents(cchPreprocessor->cchVertexCount(), tail, head);
+}
+
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::releaseUpdateState() {
+    if (state == CustomizerState::PERFECT_CUSTOMIZED)
+        (void) getQueryGraph();
+    releaseVector(perfectForwardWeights);
+    releaseVector(perfectBackwardWeights);
+    // Staged weights the metric was customized from are still read by queries.
+    if(!isStagingInputWeights())
+        releaseVector(stagedInputWeights);
+    releaseVector(blockedInputEdges);
+    releaseVector(queuedEdgeWords);
+    releaseVector(queuedVertexWords);
+    releaseVector(queuedVerticesByLevel);
+    releaseVector(previousAttributes);
+    updateQueue = MonotoneBitsetQueue();
+    perfectUpdateQueue = MonotoneBitsetQueue();
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchCustomizer<WeightType>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("forwardWeights", forwardWeights)
+         .add("backwardWeights", backwardWeights)
+         .add("perfectForwardWeights", perfectForwardWeights)
+         .add("perfectBackwardWeights", perfectBackwardWeights)
+         .add("stagedInputWeights", stagedInputWeights)
+         .add("inputAttributes", inputAttributes)
+         .add("forwardAttributes", forwardAttributes)
+         .add("backwardAttributes", backwardAttributes)
+         .add("stronglyConnectedComponent", stronglyConnectedComponent)
+         .add("weaklyConnectedComponent", weaklyConnectedComponent)
+         .add("blockedInputEdges", blockedInputEdges);
+    usage.add("updateQueue", updateQueue.memoryUsage())
+         .add("perfectUpdateQueue", perfectUpdateQueue.memoryUsage())
+         .add("queuedEdgeWords", queuedEdgeWords)
+         .add("queuedVertexWords", queuedVertexWords);
+
+    // The vertex lists of all levels are accounted as one array.
+    std::size_t levelBytes = queuedVerticesByLevel.capacity() * sizeof(std::vector<VertexId>);
+    for (const auto &level: queuedVerticesByLevel)
+        levelBytes += level.capacity() * sizeof(VertexId);
+    usage.add("queuedVerticesByLevel", levelBytes);
+
+    // The shared query graph is owned by the customizer, queries only hold references to it.
+    std::lock_guard lock(sharedQueryGraph.mutex);
+    if (sharedQueryGraph.graph)
+        usage.add("queryGraph", sharedQueryGraph.graph->memoryUsage());
+    return usage;
+}
+
+template<typename WeightType>
+std::size_t OptimizedKit::CchCustomizer<WeightType>::adviseHugePages(HugePagePolicy policy) const {
+    std::size_t advisedBytes = 0;
+    for (const auto *vector: {&forwardWeights, &backwardWeights, &perfectForwardWeights, &perfectBackwardWeights,
+                              &stagedInputWeights, &inputAttributes, &forwardAttributes, &backwardAttributes})
+        advisedBytes += OptimizedKit::adviseHugePages(*vector, policy);
+
+    // The shared query graph is a huge page allocation of its own, it is repacked into memory of the policy.
+    std::lock_guard lock(sharedQueryGraph.mutex);
+    sharedQueryGraph.hugePagePolicy = policy;
+    if (sharedQueryGraph.graph && sharedQueryGraph.graph->arcs.get_allocator().getPolicy() != policy) {
+        auto queryGraph = std::make_shared<CchQueryGraph<WeightType>>(*sharedQueryGraph.graph);
+        queryGraph->setHugePagePolicy(policy);
+        sharedQueryGraph.graph = std::move(queryGraph);
+    }
+    return advisedBytes + OptimizedKit::adviseHugePages(stronglyConnectedComponent, policy) +
+           OptimizedKit::adviseHugePages(weaklyConnectedComponent, policy);
+}
+
+template<typename WeightType>
+std::shared_ptr<const OptimizedKit::CchQueryGraph<WeightType>> OptimizedKit::CchCustomizer<WeightType>::getQueryGraph() const {
+    std::lock_guard lock(sharedQueryGraph.mutex);
+    if (!sharedQueryGraph.graph || sharedQueryGraph.metricVersion != metricVersion) {
+        assert(!cchPreprocessor->hasCompressedTopology() &&
+               "The query graph must be packed before the topology is compressed.");
+        auto queryGraph = std::make_shared<CchQueryGraph<WeightType>>();
+        queryGraph->setHugePagePolicy(sharedQueryGraph.hugePagePolicy);
+        if (state == CustomizerState::PERFECT_CUSTOMIZED) {
+            // Arcs pruned in both directions are never relaxed, leaving them out keeps queries from scanning them.
+            assert(perfectForwardWeights.size() == cchPreprocessor->cchEdgeCount() &&
+                   "The perfect metric must be packed before its update state is released.");
+            queryGraph->buildCompacted(cchPreprocessor->upwardsGraph, cchPreprocessor->cchVertexCount(),
+                                       [&](EdgeId edge) {
+                return std::make_pair(prunedForwardWeight(edge), prunedBackwardWeight(edge));
+            });
+        } else {
+            queryGraph->build(CchGraph<WeightType>(cchPreprocessor, this));
+        }
+        sharedQueryGraph.graph = std::move(queryGraph);
+        sharedQueryGraph.metricVersion = metricVersion;
+    }
+    return sharedQueryGraph.graph;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchCustomizer<WeightType>::mayReach(VertexId source, VertexId target) const {
+    assert(source < stronglyConnectedComponent.size() && target < stronglyConnectedComponent.size());
+    return weaklyConnectedComponent[source] == weaklyConnectedComponent[target] &&
+           stronglyConnectedComponent[source] >= stronglyConnectedComponent[target];
 }
 
 template<typename WeightType>
 void OptimizedKit::CchCustomizer<WeightType>::relaxLowerTriangle(EdgeId ab,
                                                                  EdgeId ac,
                                                                  EdgeId bc,
-                                                                 VertexId a,
-                                                                 VertexId b,
-                                                                 VertexId c) {
-    updateIfSmaller(forwardWeights[bc], backwardWeights[ab] + forwardWeights[ac]);
-    updateIfSmaller(backwardWeights[bc], forwardWeights[ab] + backwardWeights[ac]);
+                                                                 VertexId /*a*/,
+                                                                 VertexId /*b*/,
+                                                                 VertexId /*c*/) {
+    if(attributeCount == 0){
+        forwardWeights[bc] = Traits::min(forwardWeights[bc], Traits::add(backwardWeights[ab], forwardWeights[ac]));
+        backwardWeights[bc] = Traits::min(backwardWeights[bc], Traits::add(forwardWeights[ab], backwardWeights[ac]));
+        return;
+    }
+    relaxAttributed(forwardWeights[bc], &forwardAttributes[bc * attributeCount], Traits::add(backwardWeights[ab], forwardWeights[ac]),
+                    &backwardAttributes[ab * attributeCount], &forwardAttributes[ac * attributeCount]);
+    relaxAttributed(backwardWeights[bc], &backwardAttributes[bc * attributeCount], Traits::add(forwardWeights[ab], backwardWeights[ac]),
+                    &forwardAttributes[ab * attributeCount], &backwardAttributes[ac * attributeCount]);
 }
 
 template<typename WeightType>
 OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::baseCustomization() {
+    assert(!cchPreprocessor->hasCompressedTopology() && "Customization needs the uncompressed topology.");
+    auto startTime = std::chrono::steady_clock::now();
+
     // Construct respecting metric based on weights.
     extractRespectingMetric();
 
@@ -120,9 +381,8 @@ OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>
         }
 
         // Construct ab and ac edges and relax together with bc edge.
-        for(EdgeId ba = cchPreprocessor->downwardsGraph.adjacencyIndices[b]; ba < cchPreprocessor->downwardsGraph.adjacencyIndices[b + 1]; ++ba){
+        cchPreprocessor->forEachDownwardsEdge(b, [&](EdgeId ba, VertexId a){
             EdgeId ab = cchPreprocessor->downwardsToUpwardsGraph[ba];
-            VertexId a = cchPreprocessor->downwardsGraph.head[ba];
 
             // Speed up by iterating from the highest rank downwards.
             assert(cchPreprocessor->upwardsGraph.adjacencyIndices[a] <= ab);
@@ -132,50 +392,65 @@ OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>
                 if (c <= b) { break; }
                 relaxLowerTriangle(ab, ac, bcIds[c], a, b, c);
             }
-        }
+        });
     }
+    refreshReachability();
     state = CustomizerState::BASE_CUSTOMIZED;
+    ++metricVersion;
+    fullCustomizationDuration = std::chrono::steady_clock::now() - startTime;
     return *this;
 }
 
 template<typename WeightType>
-OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::perfectCustomization() {
-    // Ensure that base customization has been performed.
-    if(state == CustomizerState::UNCUSTOMIZED)
-        baseCustomization();
+void OptimizedKit::CchCustomizer<WeightType>::recustomizePerfectVertex(VertexId x, UpdateStatistics &statistics) {
+    const auto &adjacencyIndices = cchPreprocessor->upwardsGraph.adjacencyIndices;
 
-    // Mark edges to be deleted during perfect witness search.
-    Filter removeForwardEdgeFilter(cchPreprocessor->cchEdgeCount(), false);
-    Filter removeBackwardEdgeFilter(cchPreprocessor->cchEdgeCount(), false);
-    for(EdgeId edge = 0; edge < cchPreprocessor->cchEdgeCount(); ++edge){
-        removeForwardEdgeFilter[edge] = forwardWeights[edge] == INFINITY_WEIGHT<WeightType>;
-        removeBackwardEdgeFilter[edge] = backwardWeights[edge] == INFINITY_WEIGHT<WeightType>;
+    // Restart from the base metric as all arcs of x are only ever relaxed while processing x.
+    for(EdgeId edge = adjacencyIndices[x]; edge < adjacencyIndices[x + 1]; ++edge){
+        perfectForwardWeights[edge] = forwardWeights[edge];
+        perfectBackwardWeights[edge] = backwardWeights[edge];
     }
 
-    // Enumerate over all edges decreasing by rank, and relax the intermediate and upper triangles.
-    for(EdgeId edge = cchPreprocessor->cchEdgeCount(); edge > 0; --edge){
-        enumerateUpperTriangles(*cchPreprocessor, edge - 1, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c){
+    // Enumerate over all arcs of x decreasing by rank, and relax the intermediate and upper triangles.
+    for(EdgeId edge = adjacencyIndices[x + 1]; edge > adjacencyIndices[x]; --edge){
+        enumerateUpperTriangles(*cchPreprocessor, edge - 1, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId, VertexId, VertexId){
+            ++statistics.numTrianglesEnumerated;
+
             // Upper triangles check.
-            if(forwardWeights[ab] > forwardWeights[ac] + backwardWeights[bc]){
-                forwardWeights[ab] = forwardWeights[ac] + backwardWeights[bc];
-                removeForwardEdgeFilter[ab] = true;
-            }
-            if(backwardWeights[ab] > backwardWeights[ac] + forwardWeights[bc]){
-                backwardWeights[ab] = backwardWeights[ac] + forwardWeights[bc];
-                removeBackwardEdgeFilter[ab] = true;
-            }
+            perfectForwardWeights[ab] = Traits::min(perfectForwardWeights[ab], Traits::add(perfectForwardWeights[ac], perfectBackwardWeights[bc]));
+            perfectBackwardWeights[ab] = Traits::min(perfectBackwardWeights[ab], Traits::add(perfectBackwardWeights[ac], perfectForwardWeights[bc]));
 
             // Intermediate triangles check.
-            if(forwardWeights[ac] > forwardWeights[ab] + forwardWeights[bc]){
-                forwardWeights[ac] = forwardWeights[ab] + forwardWeights[bc];
-                removeForwardEdgeFilter[ac] = true;
-            }
-            if(backwardWeights[ac] > backwardWeights[ab] + backwardWeights[bc]){
-                backwardWeights[ac] = backwardWeights[ab] + backwardWeights[bc];
-                removeBackwardEdgeFilter[ac] = true;
-            }
+            perfectForwardWeights[ac] = Traits::min(perfectForwardWeights[ac], Traits::add(perfectForwardWeights[ab], perfectForwardWeights[bc]));
+            perfectBackwardWeights[ac] = Traits::min(perfectBackwardWeights[ac], Traits::add(perfectBackwardWeights[ab], perfectBackwardWeights[bc]));
         });
     }
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCustomizer<WeightType>::prunedForwardWeight(EdgeId edge) const {
+    // Directions shortened by a witness via higher vertices are not part of any shortest path and stay disabled.
+    return perfectForwardWeights[edge] == forwardWeights[edge] ? forwardWeights[edge] : INFINITY_WEIGHT<WeightType>;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchCustomizer<WeightType>::prunedBackwardWeight(EdgeId edge) const {
+    return perfectBackwardWeights[edge] == backwardWeights[edge] ? backwardWeights[edge] : INFINITY_WEIGHT<WeightType>;
+}
+
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::perfectCustomization() {
+    // Ensure that base customization has been performed.
+    if(state == CustomizerState::UNCUSTOMIZED)
+        baseCustomization();
+    auto startTime = std::chrono::steady_clock::now();
+
+    // The base metric is kept untouched to allow partial updates and path unpacking.
+    perfectForwardWeights.resize(cchPreprocessor->cchEdgeCount());
+    perfectBackwardWeights.resize(cchPreprocessor->cchEdgeCount());
+    UpdateStatistics statistics;
+    for(VertexId x = cchPreprocessor->cchVertexCount(); x > 0; --x)
+        recustomizePerfectVertex(x - 1, statistics);
 
     // If debug mode then calculate the number of changed weights by the perfect customization.
     if(debug) {
@@ -183,95 +458,368 @@ OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>
         for (EdgeId edge = 0; edge < cchPreprocessor->cchEdgeCount(); ++edge) {
             if (!cchPreprocessor->doesCchEdgeHaveInputEdge[edge])
                 continue;
-            if (removeBackwardEdgeFilter[edge] != removeForwardEdgeFilter[edge])
+            if ((prunedBackwardWeight(edge) == INFINITY_WEIGHT<WeightType>) !=
+                (prunedForwardWeight(edge) == INFINITY_WEIGHT<WeightType>))
                 ++numChangedWeights;
         }
         std::cout << "INFO: Number of changed weights by perfect customization: " << numChangedWeights << std::endl;
     }
 
-    // Delete edges during perfect witness search that are not part of the shortest paths.
-    Filter removeEdgeFilter(cchPreprocessor->cchEdgeCount(), false);
-    assert(removeBackwardEdgeFilter.size() == removeForwardEdgeFilter.size());
-    assert(removeBackwardEdgeFilter.size() == cchPreprocessor->cchEdgeCount());
-    for(unsigned i = 0; i < cchPreprocessor->cchEdgeCount(); i++){
-        removeEdgeFilter[i] = removeForwardEdgeFilter[i] && removeBackwardEdgeFilter[i];
-    }
-    removeElementsByFilterInplace(forwardWeights, removeEdgeFilter);
-    removeElementsByFilterInplace(backwardWeights, removeEdgeFilter);
-    this->cchPreprocessor->removeEdges(removeEdgeFilter);
-
     state = CustomizerState::PERFECT_CUSTOMIZED;
+    ++metricVersion;
+    fullCustomizationDuration += std::chrono::steady_clock::now() - startTime;
     return *this;
 }
 
+template<typename WeightType>
+OptimizedKit::EdgeId OptimizedKit::CchCustomizer<WeightType>::perfectEdgeCount() const {
+    assert(state == CustomizerState::PERFECT_CUSTOMIZED && "Customizer must be perfect customized.");
+    EdgeId count = 0;
+    for(EdgeId edge = 0; edge < cchPreprocessor->cchEdgeCount(); ++edge){
+        if(prunedForwardWeight(edge) != INFINITY_WEIGHT<WeightType> || prunedBackwardWeight(edge) != INFINITY_WEIGHT<WeightType>)
+            ++count;
+    }
+    return count;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::enqueueUpdate(EdgeId inputEdge) {
+    assert(inputEdge < cchPreprocessor->inputEdgeToCchEdge.size() && "Update id out of bounds.");
+    ++updateStatistics.numInputEdgesUpdated;
+    auto edge = cchPreprocessor->inputEdgeToCchEdge[inputEdge];
+    if(edge != INVALID_VALUE < EdgeId >)
+        updateQueue.insert(edge);
+}
 
 template<typename WeightType>
-OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::update(const std::vector<unsigned int> &updateIds) {
+OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::update(const std::vector<EdgeId> &updateIds) {
     assert(state != CustomizerState::UNCUSTOMIZED && "Customizer must be customized before updating.");
+    updateStatistics = UpdateStatistics();
+    if(updateQueue.capacity() != cchPreprocessor->cchEdgeCount())
+        updateQueue.resize(cchPreprocessor->cchEdgeCount());
 
-    // Extract all desired updates.
-    OptimizedKit::AbstractHeap<unsigned, unsigned>* q;
-    switch (heapType) {
-        case HeapType::BINARY:
-            q = new BinaryMinHeap<unsigned, unsigned>();
-            break;
-        case HeapType::PAIRING:
-            q = new PairingMinHeap<unsigned, unsigned>();
-            break;
-        default:
-            throw std::runtime_error("Heap type not supported.");
+    // Extract all desired updates, staged weights of the updated edges follow the caller's array again.
+    bool isStaging = isStagingInputWeights();
+    for(auto update : updateIds){
+        if(isStaging){
+            assert(update < stagedInputWeights.size() && "Update id out of bounds.");
+            stagedInputWeights[update] = callerInputWeights[update];
+        }
+        enqueueUpdate(update);
     }
+    propagateUpdates();
+    return *this;
+}
 
-    for(auto update : updateIds){
-        assert(update < cchPreprocessor->inputEdgeToCchEdge.size() && "Update id out of bounds.");
-        auto edge = cchPreprocessor->inputEdgeToCchEdge[update];
-        if(edge != INVALID_VALUE < EdgeId >)
-            q->insertOrUpdate(edge);
-    }
-
-    // Re-customize edges in increasing order of id.
-    while(!q->isEmpty()){
-        EdgeId uv = q->deleteMin();
-
-        // Save old weights before reset to determine if full triangle enumeration is necessary.
-        auto prevForwardWeight = forwardWeights[uv];
-        auto prevBackwardWeight = backwardWeights[uv];
-        forwardWeights[uv] = INFINITY_WEIGHT<WeightType>;
-        backwardWeights[uv] = INFINITY_WEIGHT<WeightType>;
-
-        // Re-compute basic weights
-        extractEdgeWeight(uv);
-        enumerateLowerTriangles(*cchPreprocessor, uv, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c){
-            relaxLowerTriangle(ab, ac, bc, a, b, c);
-        });
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &
+OptimizedKit::CchCustomizer<WeightType>::applyWeightDeltas(std::span<const std::pair<EdgeId, WeightType>> weightDeltas) {
+    assert(state != CustomizerState::UNCUSTOMIZED && "Customizer must be customized before updating.");
+    updateStatistics = UpdateStatistics();
+    if(updateQueue.capacity() != cchPreprocessor->cchEdgeCount())
+        updateQueue.resize(cchPreprocessor->cchEdgeCount());
+
+    // Stage a private copy of the input weights once so that deltas do not write into the caller's array.
+    auto inputEdgeCount = cchPreprocessor->inputGraph.getEdgeCount();
+    if(stagedInputWeights.size() != inputEdgeCount || !isStagingInputWeights()) {
+        callerInputWeights = inputWeights;
+        stagedInputWeights.assign(inputWeights, inputWeights + inputEdgeCount);
+        inputWeights = stagedInputWeights.data();
+    }
 
-        // Check if other edges might be affected.
-        if(forwardWeights[uv] == prevForwardWeight && backwardWeights[uv] == prevBackwardWeight)
+    // Write the deltas, later deltas of the same edge win and unchanged weights are skipped.
+    for(const auto &[inputEdge, weight] : weightDeltas){
+        assert(inputEdge < inputEdgeCount && "Update id out of bounds.");
+        if(stagedInputWeights[inputEdge] == weight)
             continue;
+        stagedInputWeights[inputEdge] = weight;
+        enqueueUpdate(inputEdge);
+    }
+    propagateUpdates();
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::setUpdateMode(UpdateMode mode, unsigned threads) {
+    updateMode = mode;
+    threadCount = mode == UpdateMode::PARALLEL ? std::max(threads, 1u) : 1;
+    if(threadCount == 1)
+        workerPool.reset();
+    else if(!workerPool || workerPool->size() != threadCount)
+        workerPool = std::make_shared<WorkerPool>(threadCount);
+
+    // Measurements of the previous mode do not carry over.
+    updateNanosPerProcessedEdge = 0;
+    processedEdgesPerQueuedEdge = 0;
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchCustomizer<WeightType> &OptimizedKit::CchCustomizer<WeightType>::setFullCustomizationBreakEven(double factor) {
+    assert(factor >= 0 && "The break-even factor must not be negative.");
+    fullCustomizationBreakEven = factor;
+    return *this;
+}
+
+template<typename WeightType>
+template<class OnAffected>
+bool OptimizedKit::CchCustomizer<WeightType>::recustomizeEdge(EdgeId uv, unsigned thread, UpdateStatistics &statistics,
+                                                              const OnAffected &onAffected) {
+    ++statistics.numCchEdgesProcessed;
+
+    // Save old weights before reset to determine if full triangle enumeration is necessary.
+    auto prevForwardWeight = forwardWeights[uv];
+    auto prevBackwardWeight = backwardWeights[uv];
+    auto &prevAttributes = previousAttributes[thread];
+    if(attributeCount != 0){
+        prevAttributes.assign(forwardAttributes.begin() + uv * attributeCount, forwardAttributes.begin() + (uv + 1) * attributeCount);
+        prevAttributes.insert(prevAttributes.end(), backwardAttributes.begin() + uv * attributeCount,
+                              backwardAttributes.begin() + (uv + 1) * attributeCount);
+    }
+    forwardWeights[uv] = INFINITY_WEIGHT<WeightType>;
+    backwardWeights[uv] = INFINITY_WEIGHT<WeightType>;
+
+    // Re-compute basic weights
+    extractEdgeWeight(uv);
+    enumerateLowerTriangles(*cchPreprocessor, uv, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c){
+        ++statistics.numTrianglesEnumerated;
+        relaxLowerTriangle(ab, ac, bc, a, b, c);
+    });
+
+    // Check if other edges might be affected, a different winning triangle of equal weight changes the attributes only.
+    auto haveAttributesChanged = [&]{
+        return !std::equal(prevAttributes.begin(), prevAttributes.begin() + attributeCount, forwardAttributes.begin() + uv * attributeCount) ||
+               !std::equal(prevAttributes.begin() + attributeCount, prevAttributes.end(), backwardAttributes.begin() + uv * attributeCount);
+    };
+    if(forwardWeights[uv] == prevForwardWeight && backwardWeights[uv] == prevBackwardWeight &&
+       (attributeCount == 0 || !haveAttributesChanged()))
+        return false;
+    ++statistics.numCchEdgesChanged;
+    if((forwardWeights[uv] < INFINITY_WEIGHT<WeightType>) != (prevForwardWeight < INFINITY_WEIGHT<WeightType>) ||
+       (backwardWeights[uv] < INFINITY_WEIGHT<WeightType>) != (prevBackwardWeight < INFINITY_WEIGHT<WeightType>))
+        ++statistics.numCchEdgesChangedReachability;
+
+    // Add other edges to partial update if they were affected by the partial update, with secondary attributes a new
+    // equally short triangle may win the tie-break.
+    // Saturated sums are never tight, an infinite edge is not derived from any triangle.
+    auto isTight = [](WeightType sum, WeightType weight){
+        return sum == weight && !Traits::isInfinite(sum);
+    };
+    auto mayImprove = [&](WeightType candidate, WeightType weight){
+        return candidate < weight || (attributeCount != 0 && isTight(candidate, weight));
+    };
+    enumerateIntermediateTriangles(*cchPreprocessor,uv, [&](EdgeId ab, EdgeId, EdgeId bc, VertexId, VertexId b, VertexId){
+        ++statistics.numTrianglesEnumerated;
+        if(
+                isTight(Traits::add(backwardWeights[ab], prevForwardWeight), forwardWeights[bc]) ||
+                isTight(Traits::add(prevBackwardWeight, forwardWeights[ab]), backwardWeights[bc]) ||
+                mayImprove(Traits::add(backwardWeights[ab], forwardWeights[uv]), forwardWeights[bc]) ||
+                mayImprove(Traits::add(backwardWeights[uv], forwardWeights[ab]), backwardWeights[bc])
+                ){
+            onAffected(bc, b);
+        }
+    });
+    enumerateUpperTriangles(*cchPreprocessor,uv, [&](EdgeId, EdgeId ac, EdgeId bc, VertexId, VertexId b, VertexId){
+        ++statistics.numTrianglesEnumerated;
+        if(
+                isTight(Traits::add(prevBackwardWeight, forwardWeights[ac]), forwardWeights[bc]) ||
+                isTight(Traits::add(backwardWeights[ac], prevForwardWeight), backwardWeights[bc]) ||
+                mayImprove(Traits::add(backwardWeights[uv], forwardWeights[ac]), forwardWeights[bc]) ||
+                mayImprove(Traits::add(backwardWeights[ac], forwardWeights[uv]), backwardWeights[bc])
+                ){
+            onAffected(bc, b);
+        }
+    });
+    return true;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchCustomizer<WeightType>::isFullCustomizationCheaper() const {
+    // Only decide on measurements, a customized metric can always be rebuilt from the input weights.
+    if(state == CustomizerState::UNCUSTOMIZED || fullCustomizationDuration.count() == 0 || updateNanosPerProcessedEdge == 0 ||
+       fullCustomizationBreakEven == std::numeric_limits<double>::infinity())
+        return false;
+    auto estimatedNanos = updateQueue.size() * processedEdgesPerQueuedEdge * updateNanosPerProcessedEdge;
+    return estimatedNanos > fullCustomizationBreakEven * static_cast<double>(fullCustomizationDuration.count());
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::propagateUpdates() {
+    assert(!cchPreprocessor->hasCompressedTopology() && "Customization needs the uncompressed topology.");
+    ++metricVersion;
+
+    // Fall back to a full customization if the affected set is past the measured break-even point.
+    if(isFullCustomizationCheaper()){
+        auto wasPerfectCustomized = state == CustomizerState::PERFECT_CUSTOMIZED;
+        updateQueue.clear();
+        baseCustomization();
+        if(wasPerfectCustomized)
+            perfectCustomization();
+        updateStatistics.numCchEdgesProcessed = cchPreprocessor->cchEdgeCount();
+        updateStatistics.usedFullCustomization = true;
+        return;
+    }
+
+    auto queuedEdgeCount = updateQueue.size();
+    auto startTime = std::chrono::steady_clock::now();
+    if(state == CustomizerState::PERFECT_CUSTOMIZED && perfectUpdateQueue.capacity() != cchPreprocessor->cchVertexCount())
+        perfectUpdateQueue.resize(cchPreprocessor->cchVertexCount());
+    previousAttributes.resize(threadCount);
+    if(updateMode == UpdateMode::PARALLEL){
+        propagateUpdatesInParallel();
+    } else {
+        // Re-customize edges in increasing order of id, triangles only ever enqueue edges with higher ids.
+        while(!updateQueue.isEmpty()){
+            EdgeId uv = updateQueue.deleteMin();
+            auto changed = recustomizeEdge(uv, 0, updateStatistics, [&](EdgeId bc, VertexId){
+                updateQueue.insert(bc);
+            });
+            if(changed && state == CustomizerState::PERFECT_CUSTOMIZED)
+                enqueuePerfectUpdate(cchPreprocessor->upwardsGraph.tail[uv]);
+        }
+    }
+    if(state == CustomizerState::PERFECT_CUSTOMIZED)
+        propagatePerfectUpdates();
+    if(updateStatistics.numCchEdgesChangedReachability != 0)
+        refreshReachability();
+    std::chrono::nanoseconds duration = std::chrono::steady_clock::now() - startTime;
+
+    // Track the cost of partial updates as exponential moving averages.
+    if(queuedEdgeCount == 0 || updateStatistics.numCchEdgesProcessed == 0)
+        return;
+    auto nanosPerProcessedEdge = static_cast<double>(duration.count()) / updateStatistics.numCchEdgesProcessed;
+    auto edgesPerQueuedEdge = static_cast<double>(updateStatistics.numCchEdgesProcessed) / queuedEdgeCount;
+    updateNanosPerProcessedEdge = updateNanosPerProcessedEdge == 0 ? nanosPerProcessedEdge :
+            (updateNanosPerProcessedEdge + nanosPerProcessedEdge) / 2;
+    processedEdgesPerQueuedEdge = processedEdgesPerQueuedEdge == 0 ? edgesPerQueuedEdge :
+            (processedEdgesPerQueuedEdge + edgesPerQueuedEdge) / 2;
+}
 
-        // Add other edges to partial update if they were affected by the partial update.
-        enumerateIntermediateTriangles(*cchPreprocessor,uv, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c){
-            if(
-                    backwardWeights[ab] + prevForwardWeight == forwardWeights[bc] ||
-                    prevBackwardWeight + forwardWeights[ab] == backwardWeights[bc] ||
-                    backwardWeights[ab] + forwardWeights[uv] < forwardWeights[bc] ||
-                    backwardWeights[uv] + forwardWeights[ab] < backwardWeights[bc]
-                    ){
-                q->insertOrUpdate(bc);
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::propagateUpdatesInParallel() {
+    const auto &level = cchPreprocessor->eliminationTreeLevel;
+    const auto &adjacencyIndices = cchPreprocessor->upwardsGraph.adjacencyIndices;
+    queuedEdgeWords.assign((cchPreprocessor->cchEdgeCount() + 63) / 64, 0);
+    queuedVertexWords.assign((cchPreprocessor->cchVertexCount() + 63) / 64, 0);
+    // Every vertex is queued at most once per update, reserving each level to its vertex count keeps the barrier
+    // completion below from allocating.
+    if(queuedVerticesByLevel.size() != cchPreprocessor->eliminationTreeLevelCount){
+        queuedVerticesByLevel.assign(cchPreprocessor->eliminationTreeLevelCount, {});
+        std::vector<VertexId> levelSizes(cchPreprocessor->eliminationTreeLevelCount, 0);
+        for(auto vertexLevel : level)
+            ++levelSizes[vertexLevel];
+        for(VertexId l = 0; l < levelSizes.size(); ++l)
+            queuedVerticesByLevel[l].reserve(levelSizes[l]);
+    }
+    for(auto &vertices : queuedVerticesByLevel)
+        vertices.clear();
+
+    // Marks an edge and groups its tail by elimination tree level, returns true if the tail was not yet queued.
+    auto markEdge = [&](EdgeId edge, VertexId tail){
+        std::atomic_ref<uint64_t>(queuedEdgeWords[edge / 64]).fetch_or(uint64_t{1} << (edge % 64));
+        auto vertexBit = uint64_t{1} << (tail % 64);
+        return (std::atomic_ref<uint64_t>(queuedVertexWords[tail / 64]).fetch_or(vertexBit) & vertexBit) == 0;
+    };
+    VertexId currentLevel = cchPreprocessor->eliminationTreeLevelCount;
+    while(!updateQueue.isEmpty()){
+        EdgeId edge = updateQueue.deleteMin();
+        VertexId tail = cchPreprocessor->upwardsGraph.tail[edge];
+        if(markEdge(edge, tail)){
+            queuedVerticesByLevel[level[tail]].push_back(tail);
+            currentLevel = std::min(currentLevel, level[tail]);
+        }
+    }
+
+    // Edges of a tail only read edges of lower levels and only affect edges of higher levels, hence all tails of a
+    // level are processed concurrently while the edges of a single tail are processed in increasing order of id.
+    std::atomic<VertexId> nextVertex{0};
+    std::vector<std::vector<VertexId>> affectedVertices(threadCount);
+    std::vector<std::vector<VertexId>> changedVertices(threadCount);
+    std::vector<UpdateStatistics> statistics(threadCount);
+    auto advanceLevel = [&]() noexcept {
+        for(auto &vertices : affectedVertices){
+            for(auto vertex : vertices){
+                assert(queuedVerticesByLevel[level[vertex]].size() < queuedVerticesByLevel[level[vertex]].capacity());
+                queuedVerticesByLevel[level[vertex]].push_back(vertex);
             }
-        });
-        enumerateUpperTriangles(*cchPreprocessor,uv, [&](EdgeId ab, EdgeId ac, EdgeId bc, VertexId a, VertexId b, VertexId c){
-            if(
-                    prevBackwardWeight + forwardWeights[ac] == forwardWeights[bc] ||
-                    backwardWeights[ac] + prevForwardWeight == backwardWeights[bc] ||
-                    backwardWeights[uv] + forwardWeights[ac] < forwardWeights[bc] ||
-                    backwardWeights[ac] + forwardWeights[uv] < backwardWeights[bc]
-                    ){
-                q->insertOrUpdate(bc);
+            vertices.clear();
+        }
+        queuedVerticesByLevel[currentLevel].clear();
+        do { ++currentLevel; } while(currentLevel < queuedVerticesByLevel.size() && queuedVerticesByLevel[currentLevel].empty());
+        nextVertex = 0;
+    };
+    std::barrier levelBarrier(threadCount, advanceLevel);
+    auto worker = [&](unsigned thread){
+        while(currentLevel < queuedVerticesByLevel.size()){
+            const auto &vertices = queuedVerticesByLevel[currentLevel];
+            for(auto i = nextVertex.fetch_add(1); i < vertices.size(); i = nextVertex.fetch_add(1)){
+                VertexId a = vertices[i];
+                std::atomic_ref<uint64_t>(queuedVertexWords[a / 64]).fetch_and(~(uint64_t{1} << (a % 64)));
+                for(EdgeId uv = adjacencyIndices[a]; uv < adjacencyIndices[a + 1]; ++uv){
+                    auto edgeBit = uint64_t{1} << (uv % 64);
+                    if((std::atomic_ref<uint64_t>(queuedEdgeWords[uv / 64]).fetch_and(~edgeBit) & edgeBit) == 0)
+                        continue;
+                    auto changed = recustomizeEdge(uv, thread, statistics[thread], [&](EdgeId bc, VertexId b){
+                        if(markEdge(bc, b))
+                            affectedVertices[thread].push_back(b);
+                    });
+                    if(changed && (changedVertices[thread].empty() || changedVertices[thread].back() != a))
+                        changedVertices[thread].push_back(a);
+                }
             }
-        });
+            levelBarrier.arrive_and_wait();
+        }
+    };
+    if(workerPool)
+        workerPool->run(worker);
+    else
+        worker(0);
+
+    for(const auto &threadStatistics : statistics){
+        updateStatistics.numCchEdgesProcessed += threadStatistics.numCchEdgesProcessed;
+        updateStatistics.numCchEdgesChanged += threadStatistics.numCchEdgesChanged;
+        updateStatistics.numTrianglesEnumerated += threadStatistics.numTrianglesEnumerated;
+        updateStatistics.numCchEdgesChangedReachability += threadStatistics.numCchEdgesChangedReachability;
+    }
+    if(state == CustomizerState::PERFECT_CUSTOMIZED){
+        for(const auto &vertices : changedVertices){
+            for(auto vertex : vertices)
+                enqueuePerfectUpdate(vertex);
+        }
     }
+}
 
-    delete q;
-    return *this;
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::enqueuePerfectUpdate(VertexId x) {
+    // Vertices are processed decreasing by rank, hence they are queued by their reversed rank.
+    perfectUpdateQueue.insert(cchPreprocessor->cchVertexCount() - 1 - x);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchCustomizer<WeightType>::propagatePerfectUpdates() {
+    const auto &adjacencyIndices = cchPreprocessor->upwardsGraph.adjacencyIndices;
+    std::vector<WeightType> prevForwardWeights;
+    std::vector<WeightType> prevBackwardWeights;
+    while(!perfectUpdateQueue.isEmpty()){
+        VertexId x = cchPreprocessor->cchVertexCount() - 1 - perfectUpdateQueue.deleteMin();
+        ++updateStatistics.numPerfectVerticesProcessed;
+
+        // Re-run the upper and intermediate triangle checks of all arcs of x.
+        prevForwardWeights.assign(perfectForwardWeights.begin() + adjacencyIndices[x],
+                                  perfectForwardWeights.begin() + adjacencyIndices[x + 1]);
+        prevBackwardWeights.assign(perfectBackwardWeights.begin() + adjacencyIndices[x],
+                                   perfectBackwardWeights.begin() + adjacencyIndices[x + 1]);
+        recustomizePerfectVertex(x, updateStatistics);
+
+        // Queue lower vertices whose triangles use a changed arc of x, arcs are re-enabled or disabled when packed.
+        for(EdgeId xy = adjacencyIndices[x]; xy < adjacencyIndices[x + 1]; ++xy){
+            if(perfectForwardWeights[xy] == prevForwardWeights[xy - adjacencyIndices[x]] &&
+               perfectBackwardWeights[xy] == prevBackwardWeights[xy - adjacencyIndices[x]])
+                continue;
+            enumerateLowerTriangles(*cchPreprocessor, xy, [&](EdgeId, EdgeId, EdgeId, VertexId a, VertexId, VertexId){
+                ++updateStatistics.numTrianglesEnumerated;
+                enqueuePerfectUpdate(a);
+            });
+        }
+    }
 }
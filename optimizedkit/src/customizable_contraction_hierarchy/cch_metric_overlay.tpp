@@ -0,0 +1,160 @@
+#include <customizable_contraction_hierarchy/cch_metric_overlay.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchMetricOverlay<WeightType>::CchMetricOverlay(const CchCustomizer<WeightType> &customizer)
+        : cchCustomizer(&customizer), cchPreprocessor(customizer.cchPreprocessor),
+          baseMetricVersion(customizer.metricVersion) {}
+
+template<typename WeightType>
+OptimizedKit::CchMetricOverlay<WeightType> &OptimizedKit::CchMetricOverlay<WeightType>::clear() {
+    inputEdgeWeights.clear();
+    cchEdgeWeights.clear();
+    mayUnblockEdges = false;
+    baseMetricVersion = cchCustomizer->metricVersion;
+    ++version;
+    return *this;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchMetricOverlay<WeightType>::forwardWeight(EdgeId cchEdge) const {
+    auto changed = cchEdgeWeights.find(cchEdge);
+    return changed == cchEdgeWeights.end() ? cchCustomizer->forwardWeights[cchEdge] : changed->second.first;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchMetricOverlay<WeightType>::backwardWeight(EdgeId cchEdge) const {
+    auto changed = cchEdgeWeights.find(cchEdge);
+    return changed == cchEdgeWeights.end() ? cchCustomizer->backwardWeights[cchEdge] : changed->second.second;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchMetricOverlay<WeightType>::inputWeight(EdgeId inputEdge) const {
+    auto changed = inputEdgeWeights.find(inputEdge);
+    return changed == inputEdgeWeights.end() ? cchCustomizer->inputWeights[inputEdge] : changed->second;
+}
+
+template<typename WeightType>
+OptimizedKit::CchMetricOverlay<WeightType> &
+OptimizedKit::CchMetricOverlay<WeightType>::applyWeightDeltas(std::span<const std::pair<EdgeId, WeightType>> weightDeltas) {
+    assert(cchCustomizer != nullptr && cchCustomizer->getState() != CustomizerState::UNCUSTOMIZED);
+    assert(!isStale() && "The overlay must be refreshed after the base metric changed.");
+    if (updateQueue.capacity() != cchPreprocessor->cchEdgeCount())
+        updateQueue.resize(cchPreprocessor->cchEdgeCount());
+
+    // Record only weights differing from the base, later deltas of the same edge win.
+    for (const auto &[inputEdge, weight]: weightDeltas) {
+        assert(inputEdge < cchPreprocessor->inputEdgeToCchEdge.size() && "Update id out of bounds.");
+        if (inputWeight(inputEdge) == weight)
+            continue;
+        if (cchCustomizer->inputWeights[inputEdge] == weight)
+            inputEdgeWeights.erase(inputEdge);
+        else
+            inputEdgeWeights[inputEdge] = weight;
+        if (cchCustomizer->inputWeights[inputEdge] == INFINITY_WEIGHT<WeightType> && weight != INFINITY_WEIGHT<WeightType>)
+            mayUnblockEdges = true;
+        auto edge = cchPreprocessor->inputEdgeToCchEdge[inputEdge];
+        if (edge != INVALID_VALUE<EdgeId>)
+            updateQueue.insert(edge);
+    }
+    propagateUpdates();
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchMetricOverlay<WeightType> &
+OptimizedKit::CchMetricOverlay<WeightType>::blockInputEdges(const std::vector<EdgeId> &inputEdges) {
+    std::vector<std::pair<EdgeId, WeightType>> weightDeltas;
+    weightDeltas.reserve(inputEdges.size());
+    for (auto inputEdge: inputEdges)
+        weightDeltas.emplace_back(inputEdge, INFINITY_WEIGHT<WeightType>);
+    return applyWeightDeltas(weightDeltas);
+}
+
+template<typename WeightType>
+OptimizedKit::CchMetricOverlay<WeightType> &OptimizedKit::CchMetricOverlay<WeightType>::refresh() {
+    if (updateQueue.capacity() != cchPreprocessor->cchEdgeCount())
+        updateQueue.resize(cchPreprocessor->cchEdgeCount());
+
+    // The base metric is customized for the base input weights, all differences originate at changed input edges.
+    cchEdgeWeights.clear();
+    baseMetricVersion = cchCustomizer->metricVersion;
+    mayUnblockEdges = false;
+    for (auto it = inputEdgeWeights.begin(); it != inputEdgeWeights.end();) {
+        if (cchCustomizer->inputWeights[it->first] == it->second) {
+            it = inputEdgeWeights.erase(it);
+            continue;
+        }
+        if (cchCustomizer->inputWeights[it->first] == INFINITY_WEIGHT<WeightType> && it->second != INFINITY_WEIGHT<WeightType>)
+            mayUnblockEdges = true;
+        auto edge = cchPreprocessor->inputEdgeToCchEdge[it->first];
+        if (edge != INVALID_VALUE<EdgeId>)
+            updateQueue.insert(edge);
+        ++it;
+    }
+    propagateUpdates();
+    return *this;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchMetricOverlay<WeightType>::propagateUpdates() {
+    // Same propagation as the partial update of the customizer, triangles only enqueue edges with higher ids.
+    while (!updateQueue.isEmpty())
+        recustomizeEdge(updateQueue.deleteMin());
+    ++version;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchMetricOverlay<WeightType>::recustomizeEdge(EdgeId uv) {
+    auto prevForwardWeight = forwardWeight(uv);
+    auto prevBackwardWeight = backwardWeight(uv);
+
+    // Re-compute the weight from all input edges of uv and its lower triangles.
+    auto forwardEdgeId = cchPreprocessor->forwardGatherInputEdge[uv];
+    auto backwardEdgeId = cchPreprocessor->backwardGatherInputEdge[uv];
+    WeightType newForwardWeight = forwardEdgeId == INVALID_VALUE<EdgeId> ? INFINITY_WEIGHT<WeightType> : inputWeight(forwardEdgeId);
+    WeightType newBackwardWeight = backwardEdgeId == INVALID_VALUE<EdgeId> ? INFINITY_WEIGHT<WeightType> : inputWeight(backwardEdgeId);
+    if (cchPreprocessor->doesCchEdgeHaveExtraInputEdge[uv]) {
+        auto localId = cchPreprocessor->doesCchEdgeHaveExtraInputEdge.rank(uv);
+        for (auto extraId = cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[localId];
+             extraId < cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId)
+            updateIfSmaller(newForwardWeight, inputWeight(cchPreprocessor->extraForwardInputEdgeOfCch[extraId]));
+        for (auto extraId = cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[localId];
+             extraId < cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId)
+            updateIfSmaller(newBackwardWeight, inputWeight(cchPreprocessor->extraBackwardInputEdgeOfCch[extraId]));
+    }
+    enumerateLowerTriangles(*cchPreprocessor, uv, [&](EdgeId ab, EdgeId ac, EdgeId, VertexId, VertexId, VertexId) {
+        newForwardWeight = Traits::min(newForwardWeight, Traits::add(backwardWeight(ab), forwardWeight(ac)));
+        newBackwardWeight = Traits::min(newBackwardWeight, Traits::add(forwardWeight(ab), backwardWeight(ac)));
+    });
+
+    if (newForwardWeight == prevForwardWeight && newBackwardWeight == prevBackwardWeight)
+        return;
+    if (newForwardWeight == cchCustomizer->forwardWeights[uv] && newBackwardWeight == cchCustomizer->backwardWeights[uv])
+        cchEdgeWeights.erase(uv);
+    else
+        cchEdgeWeights[uv] = {newForwardWeight, newBackwardWeight};
+
+    // Enqueue edges whose triangles through uv were tight or improve, saturated sums are never tight.
+    auto isTight = [](WeightType sum, WeightType weight) { return sum == weight && !Traits::isInfinite(sum); };
+    enumerateIntermediateTriangles(*cchPreprocessor, uv, [&](EdgeId ab, EdgeId, EdgeId bc, VertexId, VertexId, VertexId) {
+        if (isTight(Traits::add(backwardWeight(ab), prevForwardWeight), forwardWeight(bc)) ||
+            isTight(Traits::add(prevBackwardWeight, forwardWeight(ab)), backwardWeight(bc)) ||
+            Traits::add(backwardWeight(ab), newForwardWeight) < forwardWeight(bc) ||
+            Traits::add(newBackwardWeight, forwardWeight(ab)) < backwardWeight(bc))
+            updateQueue.insert(bc);
+    });
+    enumerateUpperTriangles(*cchPreprocessor, uv, [&](EdgeId, EdgeId ac, EdgeId bc, VertexId, VertexId, VertexId) {
+        if (isTight(Traits::add(prevBackwardWeight, forwardWeight(ac)), forwardWeight(bc)) ||
+            isTight(Traits::add(backwardWeight(ac), prevForwardWeight), backwardWeight(bc)) ||
+            Traits::add(newBackwardWeight, forwardWeight(ac)) < forwardWeight(bc) ||
+            Traits::add(backwardWeight(ac), newForwardWeight) < backwardWeight(bc))
+            updateQueue.insert(bc);
+    });
+}
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchMetricOverlay<WeightType>::memoryUsage() const {
+    return MemoryUsage().add("inputEdgeWeights", inputEdgeWeights)
+                        .add("cchEdgeWeights", cchEdgeWeights)
+                        .add("updateQueue", updateQueue.memoryUsage());
+}
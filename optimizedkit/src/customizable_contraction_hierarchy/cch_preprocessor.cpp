@@ -1,23 +1,48 @@
 #include <customizable_contraction_hierarchy/cch_preprocessor.hpp>
 
-OptimizedKit::CchPreprocessor::CchPreprocessor(OptimizedKit::Order inputOrder, OptimizedKit::Graph graph) {
+OptimizedKit::CchPreprocessor::CchPreprocessor(OptimizedKit::Order inputOrder, OptimizedKit::Graph graph,
+                                               CchVertexLayout layout) {
     // Initialize preprocessing phase variables.
     order = std::move(inputOrder);
     inputGraph = std::move(graph);
     rank = invertPermutation(order);
 
-    // Preprocessing phase steps.
+    // Preprocessing phase steps, each is a phase of the memory tracker if the calling thread records them.
+    MemoryTracker::beginPhase("applyOrder");
     applyOrder();
+    MemoryTracker::beginPhase("buildConnectedComponents");
+    buildConnectedComponents();
+    MemoryTracker::beginPhase("sortGraph");
     sortGraph();
+    MemoryTracker::beginPhase("buildUpwardsGraph");
     buildUpwardsGraph();
+    if (layout == CchVertexLayout::ELIMINATION_TREE) {
+        MemoryTracker::beginPhase("applyEliminationTreeLayout");
+        applyEliminationTreeLayout();
+    }
+    MemoryTracker::beginPhase("buildInputToCchMapping");
     buildInputToCchMapping();
+    MemoryTracker::beginPhase("buildDownwardsGraph");
     buildDownwardsGraph();
+    MemoryTracker::beginPhase("buildEliminationTreeLevels");
+    buildEliminationTreeLevels();
+    MemoryTracker::beginPhase("buildCchToInputMapping");
     buildCchToInputMapping();
+    MemoryTracker::beginPhase("buildMetricExtractionPlan");
+    buildMetricExtractionPlan();
+    MemoryTracker::endPhase();
 }
 
 void OptimizedKit::CchPreprocessor::applyOrder() {
     inputGraph.tail = applyPermutationToElementsOf(rank, inputGraph.tail);
     inputGraph.head = applyPermutationToElementsOf(rank, inputGraph.head);
+    inputEdgeTail = inputGraph.tail;
+    inputEdgeHead = inputGraph.head;
+}
+
+void OptimizedKit::CchPreprocessor::buildConnectedComponents() {
+    stronglyConnectedComponent = computeStronglyConnectedComponents(cchVertexCount(), inputGraph.tail, inputGraph.head);
+    weaklyConnectedComponent = computeWeaklyConnectedComponents(cchVertexCount(), inputGraph.tail, inputGraph.head);
 }
 
 void OptimizedKit::CchPreprocessor::sortGraph() {
@@ -27,8 +52,8 @@ void OptimizedKit::CchPreprocessor::sortGraph() {
 
 void OptimizedKit::CchPreprocessor::buildUpwardsGraph() {
     // Create a symmetric graph, essentially directing all edges in both directions.
-    std::vector<unsigned> symmetricTail(inputGraph.getEdgeCount() * 2);
-    std::vector<unsigned> symmetricHead(inputGraph.getEdgeCount() * 2);
+    std::vector<VertexId> symmetricTail(inputGraph.getEdgeCount() * 2);
+    std::vector<VertexId> symmetricHead(inputGraph.getEdgeCount() * 2);
     std::copy(inputGraph.tail.begin(), inputGraph.tail.end(), symmetricTail.begin());
     std::copy(inputGraph.head.begin(), inputGraph.head.end(), symmetricHead.begin());
     std::copy(inputGraph.tail.begin(), inputGraph.tail.end(), symmetricHead.begin() + inputGraph.getEdgeCount());
@@ -38,7 +63,7 @@ void OptimizedKit::CchPreprocessor::buildUpwardsGraph() {
     Filter filter(inputGraph.getEdgeCount() * 2);
     if (inputGraph.getEdgeCount() != 0)
         filter[0] = symmetricTail[0] == symmetricHead[0];
-    for (unsigned i = 1; i < inputGraph.getEdgeCount() * 2; ++i)
+    for (EdgeId i = 1; i < inputGraph.getEdgeCount() * 2; ++i)
         filter[i] = symmetricTail[i] == symmetricHead[i] ||
                 (symmetricHead[i] == symmetricHead[i - 1] && symmetricTail[i] == symmetricTail[i - 1]);
     removeElementsByFilterInplace(symmetricTail, filter);
@@ -46,7 +71,7 @@ void OptimizedKit::CchPreprocessor::buildUpwardsGraph() {
 
     // Create an adjacency list of the symmetric graph.
     std::vector<std::vector<VertexId>> upwardsAdjacencyList(inputVertexCount());
-    for (unsigned i = 0; i < symmetricTail.size(); ++i) {
+    for (EdgeId i = 0; i < symmetricTail.size(); ++i) {
         if (symmetricTail[i] < symmetricHead[i])
             upwardsAdjacencyList[symmetricTail[i]].push_back(symmetricHead[i]);
     }
@@ -80,10 +105,37 @@ void OptimizedKit::CchPreprocessor::buildUpwardsGraph() {
     upwardsGraph.createAdjacencyIndices();
 }
 
+void OptimizedKit::CchPreprocessor::applyEliminationTreeLayout() {
+    // The parent of a vertex in the elimination tree is its lowest upwards neighbour.
+    std::vector<VertexId> parent(cchVertexCount(), INVALID_VALUE<VertexId>);
+    for (VertexId vertex = 0; vertex < cchVertexCount(); ++vertex)
+        if (upwardsGraph.adjacencyIndices[vertex] != upwardsGraph.adjacencyIndices[vertex + 1])
+            parent[vertex] = upwardsGraph.head[upwardsGraph.adjacencyIndices[vertex]];
+    auto newId = computeForestPostOrder(parent);
+    releaseVector(parent);
+
+    // Renumber the order and the input graph, then redo the steps depending on the numbering.
+    inplaceApplyPermutationToElementsOf(newId, rank);
+    order = invertPermutation(rank);
+    inplaceApplyPermutationToElementsOf(newId, inputEdgeTail);
+    inplaceApplyPermutationToElementsOf(newId, inputEdgeHead);
+    inputGraph.tail = inputEdgeTail;
+    inputGraph.head = inputEdgeHead;
+    buildConnectedComponents();
+    sortGraph();
+
+    // Upwards edges lead to ancestors in the elimination tree, which stay above their descendants in a post-order.
+    inplaceApplyPermutationToElementsOf(newId, upwardsGraph.tail);
+    inplaceApplyPermutationToElementsOf(newId, upwardsGraph.head);
+    auto p = computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(upwardsGraph.tail, upwardsGraph.head);
+    upwardsGraph.head = applyInversePermutation(p, upwardsGraph.head);
+    upwardsGraph.createAdjacencyIndices();
+}
+
 void OptimizedKit::CchPreprocessor::buildInputToCchMapping() {
     isInputEdgeUpwards.resize(inputGraph.getEdgeCount(), false);
     if (upwardsGraph.getEdgeCount() == 0) {
-        inputEdgeToCchEdge.resize(inputGraph.getEdgeCount(), OptimizedKit::INVALID_VALUE<unsigned>);
+        inputEdgeToCchEdge.resize(inputGraph.getEdgeCount(), OptimizedKit::INVALID_VALUE<EdgeId>);
         return;
     }
     inputEdgeToCchEdge.resize(inputGraph.getEdgeCount());
@@ -151,34 +203,47 @@ void OptimizedKit::CchPreprocessor::buildDownwardsGraph() {
     downwardsGraph.createAdjacencyIndices();
 }
 
+void OptimizedKit::CchPreprocessor::buildEliminationTreeLevels() {
+    // The parent of a vertex in the elimination tree is its lowest upwards neighbour, children always have lower ranks.
+    eliminationTreeLevel.assign(cchVertexCount(), 0);
+    eliminationTreeLevelCount = cchVertexCount() == 0 ? 0 : 1;
+    for (VertexId vertex = 0; vertex < cchVertexCount(); ++vertex) {
+        if (upwardsGraph.adjacencyIndices[vertex] == upwardsGraph.adjacencyIndices[vertex + 1])
+            continue;
+        VertexId parent = upwardsGraph.head[upwardsGraph.adjacencyIndices[vertex]];
+        updateIfLarger(eliminationTreeLevel[parent], eliminationTreeLevel[vertex] + 1);
+        updateIfLarger(eliminationTreeLevelCount, eliminationTreeLevel[parent] + 1);
+    }
+}
+
 void OptimizedKit::CchPreprocessor::buildCchToInputMapping() {
-    doesCchEdgeHaveInputEdge.resize(upwardsGraph.getEdgeCount(), false);
+    Filter hasInputEdge(upwardsGraph.getEdgeCount(), false);
 
     // Persist state mappings from input edge to cch edge.
     for (EdgeId inputEdge = 0; inputEdge < inputGraph.getEdgeCount(); ++inputEdge) {
         if (inputEdgeToCchEdge[inputEdge] != OptimizedKit::INVALID_VALUE<EdgeId>) {
-            doesCchEdgeHaveInputEdge[inputEdgeToCchEdge[inputEdge]] = true;
+            hasInputEdge[inputEdgeToCchEdge[inputEdge]] = true;
         }
     }
 
     // Initialize forward and backward input edge vectors.
-    doesCchEdgeHaveInputEdgeMapper = IdMapper(doesCchEdgeHaveInputEdge);
-    forwardInputEdgeOfCchEdge.resize(doesCchEdgeHaveInputEdgeMapper.getLocalIdCount());
-    backwardInputEdgeOfCchEdge.resize(doesCchEdgeHaveInputEdgeMapper.getLocalIdCount());
+    doesCchEdgeHaveInputEdge = RankBitVector(hasInputEdge);
+    forwardInputEdgeOfCchEdge.resize(doesCchEdgeHaveInputEdge.count());
+    backwardInputEdgeOfCchEdge.resize(doesCchEdgeHaveInputEdge.count());
     std::fill(forwardInputEdgeOfCchEdge.begin(), forwardInputEdgeOfCchEdge.end(), OptimizedKit::INVALID_VALUE<EdgeId>);
     std::fill(backwardInputEdgeOfCchEdge.begin(), backwardInputEdgeOfCchEdge.end(), OptimizedKit::INVALID_VALUE<EdgeId>);
-    doesCchEdgeHaveExtraInputEdge.resize(upwardsGraph.getEdgeCount(), false);
+    Filter hasExtraInputEdge(upwardsGraph.getEdgeCount(), false);
 
     // Identify edges that were added extra to the cch graph and map upwards/downwards to forward/backward edges.
     for (EdgeId inputEdge = 0; inputEdge < inputGraph.getEdgeCount(); ++inputEdge) {
         auto cchEdge = inputEdgeToCchEdge[inputEdge];
         if (cchEdge != OptimizedKit::INVALID_VALUE<EdgeId>) {
-            auto id = doesCchEdgeHaveInputEdgeMapper.toLocal(cchEdge);
+            auto id = doesCchEdgeHaveInputEdge.rank(cchEdge);
             if (isInputEdgeUpwards[inputEdge]) {
                 if (forwardInputEdgeOfCchEdge[id] == OptimizedKit::INVALID_VALUE<EdgeId>) {
                     forwardInputEdgeOfCchEdge[id] = inputEdge;
                 } else {
-                    doesCchEdgeHaveExtraInputEdge[cchEdge] = true;
+                    hasExtraInputEdge[cchEdge] = true;
                     extraForwardInputEdgeOfCchAdjacencyEdges.push_back(cchEdge);
                     extraForwardInputEdgeOfCch.push_back(inputEdge);
                 }
@@ -186,7 +251,7 @@ void OptimizedKit::CchPreprocessor::buildCchToInputMapping() {
                 if (backwardInputEdgeOfCchEdge[id] == OptimizedKit::INVALID_VALUE<EdgeId>) {
                     backwardInputEdgeOfCchEdge[id] = inputEdge;
                 } else {
-                    doesCchEdgeHaveExtraInputEdge[cchEdge] = true;
+                    hasExtraInputEdge[cchEdge] = true;
                     extraBackwardInputEdgeOfCchAdjacencyEdges.push_back(cchEdge);
                     extraBackwardInputEdgeOfCch.push_back(inputEdge);
                 }
@@ -195,11 +260,11 @@ void OptimizedKit::CchPreprocessor::buildCchToInputMapping() {
     }
 
     // Map extra input edges to local ids.
-    doesCchEdgeHaveExtraInputEdgeMapper = IdMapper(doesCchEdgeHaveExtraInputEdge);
+    doesCchEdgeHaveExtraInputEdge = RankBitVector(hasExtraInputEdge);
     for (auto &x: extraForwardInputEdgeOfCchAdjacencyEdges)
-        x = doesCchEdgeHaveExtraInputEdgeMapper.toLocal(x);
+        x = doesCchEdgeHaveExtraInputEdge.rank(x);
     for (auto &x: extraBackwardInputEdgeOfCchAdjacencyEdges)
-        x = doesCchEdgeHaveExtraInputEdgeMapper.toLocal(x);
+        x = doesCchEdgeHaveExtraInputEdge.rank(x);
 
     // Sort extra input edges by cch edge id.
     {
@@ -207,7 +272,7 @@ void OptimizedKit::CchPreprocessor::buildCchToInputMapping() {
         extraForwardInputEdgeOfCchAdjacencyEdges =
                 OptimizedKit::constructAdjacencyIndices(
                         applyInversePermutation(p, std::move(extraForwardInputEdgeOfCchAdjacencyEdges)),
-                        doesCchEdgeHaveExtraInputEdgeMapper.getLocalIdCount());
+                        doesCchEdgeHaveExtraInputEdge.count());
         extraForwardInputEdgeOfCch = applyInversePermutation(p, std::move(extraForwardInputEdgeOfCch));
     }
     {
@@ -215,13 +280,46 @@ void OptimizedKit::CchPreprocessor::buildCchToInputMapping() {
         extraBackwardInputEdgeOfCchAdjacencyEdges =
                 OptimizedKit::constructAdjacencyIndices(
                         applyInversePermutation(p, std::move(extraBackwardInputEdgeOfCchAdjacencyEdges)),
-                        doesCchEdgeHaveExtraInputEdgeMapper.getLocalIdCount());
+                        doesCchEdgeHaveExtraInputEdge.count());
         extraBackwardInputEdgeOfCch = applyInversePermutation(p, std::move(extraBackwardInputEdgeOfCch));
     }
 }
 
+void OptimizedKit::CchPreprocessor::buildMetricExtractionPlan() {
+    // Resolve the id mappers once, shortcut edges and missing directions gather nothing.
+    forwardGatherInputEdge.assign(cchEdgeCount(), INVALID_VALUE<EdgeId>);
+    backwardGatherInputEdge.assign(cchEdgeCount(), INVALID_VALUE<EdgeId>);
+    forwardReductionCchEdge.clear();
+    forwardReductionInputEdge.clear();
+    backwardReductionCchEdge.clear();
+    backwardReductionInputEdge.clear();
+    for (EdgeId cchEdge = 0; cchEdge < cchEdgeCount(); ++cchEdge) {
+        if (!doesCchEdgeHaveInputEdge[cchEdge])
+            continue;
+        auto localId = doesCchEdgeHaveInputEdge.rank(cchEdge);
+        forwardGatherInputEdge[cchEdge] = forwardInputEdgeOfCchEdge[localId];
+        backwardGatherInputEdge[cchEdge] = backwardInputEdgeOfCchEdge[localId];
+        if (!doesCchEdgeHaveExtraInputEdge[cchEdge])
+            continue;
+
+        // Multi-edges are reduced afterwards, the lists stay sorted by cch edge id.
+        localId = doesCchEdgeHaveExtraInputEdge.rank(cchEdge);
+        for (auto extraId = extraForwardInputEdgeOfCchAdjacencyEdges[localId];
+             extraId < extraForwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId) {
+            forwardReductionCchEdge.push_back(cchEdge);
+            forwardReductionInputEdge.push_back(extraForwardInputEdgeOfCch[extraId]);
+        }
+        for (auto extraId = extraBackwardInputEdgeOfCchAdjacencyEdges[localId];
+             extraId < extraBackwardInputEdgeOfCchAdjacencyEdges[localId + 1]; ++extraId) {
+            backwardReductionCchEdge.push_back(cchEdge);
+            backwardReductionInputEdge.push_back(extraBackwardInputEdgeOfCch[extraId]);
+        }
+    }
+}
+
 void OptimizedKit::CchPreprocessor::removeEdges(const OptimizedKit::Filter &removeEdgeFilter) {
     assert(removeEdgeFilter.size() == cchEdgeCount());
+    assert(!hasCompressedTopology() && "Edges of a compressed topology can not be removed.");
 
     // Remove edges where applicable.
     upwardsGraph.removeEdges(removeEdgeFilter);
@@ -229,11 +327,136 @@ void OptimizedKit::CchPreprocessor::removeEdges(const OptimizedKit::Filter &remo
 
     // TODO: the error must be in these or a missing one (extra)
     removeElementsByFilterInplace(cchEdgeToInputEdge, removeEdgeFilter);
-    removeElementsByFilterInplace(doesCchEdgeHaveInputEdge, removeEdgeFilter);
-    doesCchEdgeHaveInputEdgeMapper.remove(removeEdgeFilter);
-    removeElementsByFilterInplace(doesCchEdgeHaveExtraInputEdge, removeEdgeFilter);
-    doesCchEdgeHaveExtraInputEdgeMapper.remove(removeEdgeFilter);
+
+    // Local ids are ranks and shift with the removed edges, drop the entries of removed edges from the local arrays.
+    Filter removeLocalFilter;
+    Filter removeExtraLocalFilter;
+    for (EdgeId cchEdge = 0; cchEdge < removeEdgeFilter.size(); ++cchEdge) {
+        if (doesCchEdgeHaveInputEdge[cchEdge])
+            removeLocalFilter.push_back(removeEdgeFilter[cchEdge]);
+        if (doesCchEdgeHaveExtraInputEdge[cchEdge])
+            removeExtraLocalFilter.push_back(removeEdgeFilter[cchEdge]);
+    }
+    removeElementsByFilterInplace(forwardInputEdgeOfCchEdge, removeLocalFilter);
+    removeElementsByFilterInplace(backwardInputEdgeOfCchEdge, removeLocalFilter);
+    removeAdjacencyListsByFilter(extraForwardInputEdgeOfCchAdjacencyEdges, extraForwardInputEdgeOfCch,
+                                 removeExtraLocalFilter);
+    removeAdjacencyListsByFilter(extraBackwardInputEdgeOfCchAdjacencyEdges, extraBackwardInputEdgeOfCch,
+                                 removeExtraLocalFilter);
+    doesCchEdgeHaveInputEdge.remove(removeEdgeFilter);
+    doesCchEdgeHaveExtraInputEdge.remove(removeEdgeFilter);
 
     // Alter edges ids of cch edges where necessary.
     adjustElementsToRemoveFilterInPlace(inputEdgeToCchEdge, removeEdgeFilter);
+    buildMetricExtractionPlan();
+}
+
+void OptimizedKit::CchPreprocessor::releasePreprocessingState() {
+    releaseVector(inputGraph.tail);
+    releaseVector(inputGraph.head);
+    releaseVector(inputGraph.adjacencyIndices);
+    releaseVector(inputEdgeIds);
+    releaseVector(stronglyConnectedComponent);
+    releaseVector(weaklyConnectedComponent);
+    releaseVector(inputEdgeToCchEdge);
+    releaseVector(cchEdgeToInputEdge);
+    releaseVector(isInputEdgeUpwards);
+    releaseVector(eliminationTreeLevel);
+    releaseVector(forwardGatherInputEdge);
+    releaseVector(backwardGatherInputEdge);
+    releaseVector(forwardReductionCchEdge);
+    releaseVector(forwardReductionInputEdge);
+    releaseVector(backwardReductionCchEdge);
+    releaseVector(backwardReductionInputEdge);
+}
+
+void OptimizedKit::CchPreprocessor::compressTopology() {
+    compressedUpwardsGraph = CompressedGraph(upwardsGraph);
+    compressedDownwardsGraph = CompressedGraph(downwardsGraph);
+
+    // Edge ids stay those of the upwards graph, metric arrays and query graphs remain valid.
+    releaseVector(upwardsGraph.tail);
+    releaseVector(upwardsGraph.head);
+    releaseVector(upwardsGraph.adjacencyIndices);
+    releaseVector(downwardsGraph.tail);
+    releaseVector(downwardsGraph.head);
+    releaseVector(downwardsGraph.adjacencyIndices);
+}
+
+OptimizedKit::EdgeId OptimizedKit::CchPreprocessor::findUpwardsEdge(VertexId x, VertexId y) const {
+    if (!hasCompressedTopology())
+        return findEdge(upwardsGraph.adjacencyIndices, upwardsGraph.head, x, y);
+    auto range = compressedUpwardsGraph.adjacency(x);
+    for (auto it = range.begin(); it != range.end() && *it <= y; ++it)
+        if (*it == y)
+            return it.edge();
+    return INVALID_VALUE<EdgeId>;
+}
+
+std::size_t OptimizedKit::CchPreprocessor::adviseHugePages(HugePagePolicy policy) const {
+    std::size_t advisedBytes = 0;
+    auto advise = [&](const auto &vector) { advisedBytes += OptimizedKit::adviseHugePages(vector, policy); };
+    advise(order);
+    advise(rank);
+    advise(inputEdgeIds);
+    advise(inputEdgeTail);
+    advise(inputEdgeHead);
+    advise(stronglyConnectedComponent);
+    advise(weaklyConnectedComponent);
+    advise(inputEdgeToCchEdge);
+    advise(cchEdgeToInputEdge);
+    advise(downwardsToUpwardsGraph);
+    advise(eliminationTreeLevel);
+    advise(forwardInputEdgeOfCchEdge);
+    advise(backwardInputEdgeOfCchEdge);
+    advise(extraForwardInputEdgeOfCchAdjacencyEdges);
+    advise(extraBackwardInputEdgeOfCchAdjacencyEdges);
+    advise(extraForwardInputEdgeOfCch);
+    advise(extraBackwardInputEdgeOfCch);
+    advise(forwardGatherInputEdge);
+    advise(backwardGatherInputEdge);
+    advise(forwardReductionCchEdge);
+    advise(forwardReductionInputEdge);
+    advise(backwardReductionCchEdge);
+    advise(backwardReductionInputEdge);
+    return advisedBytes + inputGraph.adviseHugePages(policy) + upwardsGraph.adviseHugePages(policy) +
+           downwardsGraph.adviseHugePages(policy) + compressedUpwardsGraph.adviseHugePages(policy) +
+           compressedDownwardsGraph.adviseHugePages(policy) + doesCchEdgeHaveInputEdge.adviseHugePages(policy) +
+           doesCchEdgeHaveExtraInputEdge.adviseHugePages(policy);
+}
+
+OptimizedKit::MemoryUsage OptimizedKit::CchPreprocessor::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("order", order)
+         .add("inputGraph", inputGraph.memoryUsage())
+         .add("rank", rank)
+         .add("inputEdgeIds", inputEdgeIds)
+         .add("inputEdgeTail", inputEdgeTail)
+         .add("inputEdgeHead", inputEdgeHead)
+         .add("stronglyConnectedComponent", stronglyConnectedComponent)
+         .add("weaklyConnectedComponent", weaklyConnectedComponent)
+         .add("inputEdgeToCchEdge", inputEdgeToCchEdge)
+         .add("cchEdgeToInputEdge", cchEdgeToInputEdge)
+         .add("isInputEdgeUpwards", isInputEdgeUpwards)
+         .add("upwardsGraph", upwardsGraph.memoryUsage())
+         .add("downwardsToUpwardsGraph", downwardsToUpwardsGraph)
+         .add("downwardsGraph", downwardsGraph.memoryUsage())
+         .add("compressedUpwardsGraph", compressedUpwardsGraph.memoryUsage())
+         .add("compressedDownwardsGraph", compressedDownwardsGraph.memoryUsage())
+         .add("eliminationTreeLevel", eliminationTreeLevel);
+    usage.add("doesCchEdgeHaveInputEdge", doesCchEdgeHaveInputEdge.memoryUsage())
+         .add("forwardInputEdgeOfCchEdge", forwardInputEdgeOfCchEdge)
+         .add("backwardInputEdgeOfCchEdge", backwardInputEdgeOfCchEdge)
+         .add("doesCchEdgeHaveExtraInputEdge", doesCchEdgeHaveExtraInputEdge.memoryUsage())
+         .add("extraForwardInputEdgeOfCchAdjacencyEdges", extraForwardInputEdgeOfCchAdjacencyEdges)
+         .add("extraBackwardInputEdgeOfCchAdjacencyEdges", extraBackwardInputEdgeOfCchAdjacencyEdges)
+         .add("extraForwardInputEdgeOfCch", extraForwardInputEdgeOfCch)
+         .add("extraBackwardInputEdgeOfCch", extraBackwardInputEdgeOfCch);
+    usage.add("forwardGatherInputEdge", forwardGatherInputEdge)
+         .add("backwardGatherInputEdge", backwardGatherInputEdge)
+         .add("forwardReductionCchEdge", forwardReductionCchEdge)
+         .add("forwardReductionInputEdge", forwardReductionInputEdge)
+         .add("backwardReductionCchEdge", backwardReductionCchEdge)
+         .add("backwardReductionInputEdge", backwardReductionInputEdge);
+    return usage;
 }
@@ -0,0 +1,40 @@
+#include <customizable_contraction_hierarchy/cch_quantized_metric.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchQuantizedMetric<WeightType>::CchQuantizedMetric(const CchCustomizer<WeightType> &customizer)
+        : cchCustomizer(&customizer), cchPreprocessor(customizer.cchPreprocessor),
+          stronglyConnectedComponent(customizer.stronglyConnectedComponent),
+          weaklyConnectedComponent(customizer.weaklyConnectedComponent) {
+    static_assert(std::is_integral_v<WeightType>, "Only integral weights are quantized exactly.");
+    assert(customizer.getState() != CustomizerState::UNCUSTOMIZED);
+    assert(!cchPreprocessor->hasCompressedTopology() && "Snapshots must be taken before the topology is compressed.");
+
+    // Snapshot the base customized metric, a perfect metric is only a pruned view of it.
+    const auto &upwardsGraph = cchPreprocessor->upwardsGraph;
+    forwardWeights.build(customizer.forwardWeights.data(), upwardsGraph.tail, cchPreprocessor->cchVertexCount());
+    backwardWeights.build(customizer.backwardWeights.data(), upwardsGraph.tail, cchPreprocessor->cchVertexCount());
+    inputWeights.build(customizer.inputWeights, cchPreprocessor->inputEdgeTail, cchPreprocessor->cchVertexCount());
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuantizedMetric<WeightType>::mayReach(VertexId source, VertexId target) const {
+    assert(source < stronglyConnectedComponent.size() && target < stronglyConnectedComponent.size());
+    return weaklyConnectedComponent[source] == weaklyConnectedComponent[target] &&
+           stronglyConnectedComponent[source] >= stronglyConnectedComponent[target];
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuantizedQueryGraph<WeightType> OptimizedKit::CchQuantizedMetric<WeightType>::getQueryGraph() const {
+    assert(!cchPreprocessor->hasCompressedTopology() && "The query graph reads the uncompressed upwards graph.");
+    return CchQuantizedQueryGraph<WeightType>(cchPreprocessor->upwardsGraph, forwardWeights, backwardWeights,
+                                              cchPreprocessor->cchVertexCount());
+}
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchQuantizedMetric<WeightType>::memoryUsage() const {
+    return MemoryUsage().add("forwardWeights", forwardWeights.memoryUsage())
+                        .add("backwardWeights", backwardWeights.memoryUsage())
+                        .add("inputWeights", inputWeights.memoryUsage())
+                        .add("stronglyConnectedComponent", stronglyConnectedComponent)
+                        .add("weaklyConnectedComponent", weaklyConnectedComponent);
+}
@@ -3,9 +3,27 @@
 template<typename WeightType>
 OptimizedKit::CchQuery<WeightType>::CchQuery(const CchCustomizer <WeightType> &customizer, HeapType heapType)
         : state(QueryState::INITIALIZED), cchCustomizer(&customizer), cchPreprocessor(customizer.cchPreprocessor),
-          cchGraph(cchPreprocessor, cchCustomizer), biDirectionalDijkstra(cchGraph, heapType),
+          biDirectionalDijkstra(customizer.getQueryGraph(), heapType),
+          metricVersion(customizer.metricVersion),
           globalSource(INVALID_VALUE < VertexId > ), globalTarget(INVALID_VALUE < VertexId > ),
-          localSource(INVALID_VALUE < VertexId > ), localTarget(INVALID_VALUE < VertexId > ) {}
+          localSource(INVALID_VALUE < VertexId > ), localTarget(INVALID_VALUE < VertexId > ),
+          blockedOverlay(customizer) {}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType>::CchQuery(const CchMetricOverlay<WeightType> &overlay, HeapType heapType)
+        : CchQuery(overlay.getCustomizer(), heapType) {
+    metricOverlay = &overlay;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType>::CchQuery(const CchQuantizedMetric<WeightType> &metric, HeapType heapType)
+        : CchQuery(*metric.cchCustomizer, heapType) {
+    quantizedMetric = &metric;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType>::CchQuery(const CchServingIndex<WeightType> &index, HeapType heapType)
+        : CchQuery(index.customizer, heapType) {}
 
 template<typename WeightType>
 OptimizedKit::CchQuery<WeightType> &
@@ -13,12 +31,29 @@ OptimizedKit::CchQuery<WeightType>::reset(const CchCustomizer <WeightType> &cust
     state = QueryState::UNINITIALIZED;
     cchCustomizer = &customizer;
     cchPreprocessor = cchCustomizer->cchPreprocessor;
-    cchGraph = CchGraph(cchPreprocessor, cchCustomizer);
-    biDirectionalDijkstra = BiDirectionalDijkstra(cchGraph);
+    biDirectionalDijkstra = BiDirectionalDijkstra(cchCustomizer->getQueryGraph());
+    metricVersion = cchCustomizer->metricVersion;
+    blockedInputEdges.clear();
+    metricOverlay = nullptr;
+    patchedEdges.clear();
+    patchedOverlay = nullptr;
+    privateQueryGraph.reset();
+    quantizedMetric = nullptr;
+    searchedQuantizedMetric = nullptr;
+    blockedOverlay = CchMetricOverlay<WeightType>(customizer);
+    isBlockedOverlayBuilt = false;
+    isBlockedOverlayActive = false;
+    baseQueryGraph.reset();
+    basePatchedEdges.clear();
     globalSource = INVALID_VALUE<VertexId>;
     globalTarget = INVALID_VALUE<VertexId>;
     localSource = INVALID_VALUE<VertexId>;
     localTarget = INVALID_VALUE<VertexId>;
+    localSources.clear();
+    localTargets.clear();
+    sourceEdge = INVALID_VALUE<EdgeId>;
+    targetEdge = INVALID_VALUE<EdgeId>;
+    isSameEdgePath = false;
     vertexPath.clear();
     edgePath.clear();
     state = QueryState::INITIALIZED;
@@ -35,34 +70,349 @@ OptimizedKit::CchQuery<WeightType>::run(OptimizedKit::VertexId source, Optimized
     globalTarget = target;
     localSource = cchPreprocessor->rank[source];
     localTarget = cchPreprocessor->rank[target];
+    sourceEdge = INVALID_VALUE<EdgeId>;
+    targetEdge = INVALID_VALUE<EdgeId>;
+    isSameEdgePath = false;
+    isBlockedOverlayActive = false;
+    localSources.assign(1, {localSource, 0});
+    localTargets.assign(1, {localTarget, 0});
     vertexPath.clear();
     edgePath.clear();
+    refreshQueryGraph();
+    selectArcAttributes();
+
+    // A query from a vertex to itself meets at once, no state of the previous query must survive.
     if (localSource == localTarget) {
+        biDirectionalDijkstra.start(localSource, localTarget);
+        biDirectionalDijkstra.meetingVertex = localSource;
+        biDirectionalDijkstra.shortestPathLength = 0;
+        state = QueryState::FINISHED;
+        return *this;
+    }
+
+    // Answer queries between disconnected components without touching any heap.
+    if (!mayReach(localSource, localTarget)) {
+        biDirectionalDijkstra.shortestPathLength = INFINITY_WEIGHT<WeightType>;
+        biDirectionalDijkstra.meetingVertex = INVALID_VALUE<VertexId>;
         state = QueryState::FINISHED;
         return *this;
     }
     biDirectionalDijkstra.run(localSource, localTarget, debug);
     state = QueryState::FINISHED;
+    repairBlockedPath(debug);
     return *this;
 }
 
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &
+OptimizedKit::CchQuery<WeightType>::run(const std::vector<std::pair<VertexId, WeightType>> &sources,
+                                        const std::vector<std::pair<VertexId, WeightType>> &targets, bool debug) {
+    assert(state == QueryState::INITIALIZED || state == QueryState::FINISHED);
+    globalSource = INVALID_VALUE<VertexId>;
+    globalTarget = INVALID_VALUE<VertexId>;
+    localSource = INVALID_VALUE<VertexId>;
+    localTarget = INVALID_VALUE<VertexId>;
+    sourceEdge = INVALID_VALUE<EdgeId>;
+    targetEdge = INVALID_VALUE<EdgeId>;
+    isSameEdgePath = false;
+    isBlockedOverlayActive = false;
+    localSources.clear();
+    localTargets.clear();
+    for (const auto &[source, offset]: sources) {
+        assert(source < cchPreprocessor->rank.size() && "Source vertex id is out of bounds.");
+        localSources.emplace_back(cchPreprocessor->rank[source], offset);
+    }
+    for (const auto &[target, offset]: targets) {
+        assert(target < cchPreprocessor->rank.size() && "Target vertex id is out of bounds.");
+        localTargets.emplace_back(cchPreprocessor->rank[target], offset);
+    }
+    vertexPath.clear();
+    edgePath.clear();
+
+    refreshQueryGraph();
+    selectArcAttributes();
+
+    // Skip the search if no source can reach any target.
+    bool anyReachable = false;
+    for (const auto &source: localSources)
+        for (const auto &target: localTargets)
+            anyReachable = anyReachable || mayReach(source.first, target.first);
+    if (!anyReachable) {
+        biDirectionalDijkstra.shortestPathLength = INFINITY_WEIGHT<WeightType>;
+        biDirectionalDijkstra.meetingVertex = INVALID_VALUE<VertexId>;
+        state = QueryState::FINISHED;
+        return *this;
+    }
+
+    biDirectionalDijkstra.start(localSources, localTargets);
+    while (biDirectionalDijkstra.step(debug));
+    state = QueryState::FINISHED;
+    repairBlockedPath(debug);
+
+    // The ends of the search paths are the source and target the shortest path uses.
+    if (biDirectionalDijkstra.meetingVertex != INVALID_VALUE<VertexId>) {
+        localSource = recoverSearchPath(true).back();
+        localTarget = recoverSearchPath(false).back();
+        globalSource = cchPreprocessor->order[localSource];
+        globalTarget = cchPreprocessor->order[localTarget];
+    }
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &
+OptimizedKit::CchQuery<WeightType>::run(const EdgePosition &source, const EdgePosition &target, bool debug) {
+    assert(source.edge < cchPreprocessor->inputEdgeTail.size() && "Source edge id is out of bounds.");
+    assert(target.edge < cchPreprocessor->inputEdgeTail.size() && "Target edge id is out of bounds.");
+    assert(source.offset >= 0 && source.offset <= 1 && "Source offset is not a fraction.");
+    assert(target.offset >= 0 && target.offset <= 1 && "Target offset is not a fraction.");
+
+    // Leave the source edge at its head and enter the target edge at its tail, blocked edges can not be used.
+    isBlockedOverlayActive = false;
+    std::vector<std::pair<VertexId, WeightType>> sources, targets;
+    WeightType sourceWeight = isBlocked(source.edge) ? INFINITY_WEIGHT<WeightType> : inputWeightOf(source.edge);
+    WeightType targetWeight = isBlocked(target.edge) ? INFINITY_WEIGHT<WeightType> : inputWeightOf(target.edge);
+    if (sourceWeight != INFINITY_WEIGHT<WeightType>)
+        sources.emplace_back(cchPreprocessor->order[cchPreprocessor->inputEdgeHead[source.edge]],
+                             sourceWeight - partialWeight(source.edge, source.offset));
+    if (targetWeight != INFINITY_WEIGHT<WeightType>)
+        targets.emplace_back(cchPreprocessor->order[cchPreprocessor->inputEdgeTail[target.edge]],
+                             partialWeight(target.edge, target.offset));
+    run(sources, targets, debug);
+    sourceEdge = source.edge;
+    targetEdge = target.edge;
+    sourceOffset = source.offset;
+    targetOffset = target.offset;
+
+    // Travelling forward along a shared edge competes with leaving it and coming back.
+    if (source.edge == target.edge && source.offset <= target.offset && sourceWeight != INFINITY_WEIGHT<WeightType>) {
+        WeightType weight = partialWeight(target.edge, target.offset) - partialWeight(source.edge, source.offset);
+        if (weight <= getQueryWeight()) {
+            isSameEdgePath = true;
+            sameEdgeWeight = weight;
+            globalSource = INVALID_VALUE<VertexId>;
+            globalTarget = INVALID_VALUE<VertexId>;
+        }
+    }
+    return *this;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::partialWeight(EdgeId edge, double offset) {
+    return partialValue(inputWeightOf(edge), offset);
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::partialValue(WeightType value, double offset) {
+    if constexpr (std::is_integral_v<WeightType>)
+        return static_cast<WeightType>(std::llround(offset * static_cast<double>(value)));
+    else
+        return static_cast<WeightType>(offset * value);
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::isBlocked(EdgeId inputEdge) const {
+    return std::binary_search(blockedInputEdges.begin(), blockedInputEdges.end(), inputEdge);
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::mayReach(VertexId source, VertexId target) const {
+    // Components of the shared metric do not bound a personalized metric that unblocks edges.
+    if (quantizedMetric != nullptr)
+        return quantizedMetric->mayReach(source, target);
+    return (metricOverlay != nullptr && metricOverlay->hasUnblockedEdges()) || cchCustomizer->mayReach(source, target);
+}
+
+template<typename WeightType>
+void OptimizedKit::CchQuery<WeightType>::repairBlockedPath(bool debug) {
+    if (blockedInputEdges.empty() || biDirectionalDijkstra.meetingVertex == INVALID_VALUE<VertexId>)
+        return;
+    auto path = getEdgePath();
+    edgePath.clear();
+    if (std::none_of(path.begin(), path.end(), [&](EdgeId edge) { return isBlocked(edge); }))
+        return;
+
+    // Re-customize the cch edges affected by the blocked edges into an overlay on top of the queried metric, the
+    // overlay is reused while neither the blocked edges nor the queried metric change.
+    auto metricOverlayVersion = metricOverlay != nullptr ? metricOverlay->getVersion() : 0;
+    if (!isBlockedOverlayBuilt || blockedOverlayMetricVersion != cchCustomizer->metricVersion ||
+        blockedOverlaySource != metricOverlay || blockedOverlaySourceVersion != metricOverlayVersion) {
+        blockedOverlay = metricOverlay != nullptr ? *metricOverlay : CchMetricOverlay<WeightType>(*cchCustomizer);
+        blockedOverlay.blockInputEdges(blockedInputEdges);
+        blockedOverlayMetricVersion = cchCustomizer->metricVersion;
+        blockedOverlaySource = metricOverlay;
+        blockedOverlaySourceVersion = metricOverlayVersion;
+        isBlockedOverlayBuilt = true;
+    }
+    isBlockedOverlayActive = true;
+    selectArcAttributes();
+
+    // Search the base metric with the overlay patched in, a perfect metric may route through blocked edges anywhere.
+    // A personalized metric already searches a private graph of the base metric, the shared graph is never written.
+    if (metricOverlay != nullptr) {
+        patchQueryGraph(*privateQueryGraph, patchedEdges, &blockedOverlay);
+        biDirectionalDijkstra.start(localSources, localTargets);
+        while (biDirectionalDijkstra.step(debug));
+        patchQueryGraph(*privateQueryGraph, patchedEdges, metricOverlay);
+        return;
+    }
+    if (!baseQueryGraph || baseQueryGraphMetricVersion != cchCustomizer->metricVersion) {
+        assert(!cchPreprocessor->hasCompressedTopology() && "Overlays and blocked edges need the uncompressed topology.");
+        CchGraph<WeightType> baseGraph(&cchPreprocessor->upwardsGraph, &cchCustomizer->forwardWeights,
+                                       &cchCustomizer->backwardWeights, cchPreprocessor->cchVertexCount());
+        if (!baseQueryGraph) {
+            baseQueryGraph = std::make_shared<CchQueryGraph<WeightType>>();
+            baseQueryGraph->setHugePagePolicy(hugePagePolicy);
+        }
+        baseQueryGraph->build(baseGraph);
+        baseQueryGraphMetricVersion = cchCustomizer->metricVersion;
+        basePatchedEdges.clear();
+    }
+    auto sharedQueryGraph = biDirectionalDijkstra.queryGraph;
+    biDirectionalDijkstra.queryGraph = baseQueryGraph;
+    patchQueryGraph(*baseQueryGraph, basePatchedEdges, &blockedOverlay);
+    biDirectionalDijkstra.start(localSources, localTargets);
+    while (biDirectionalDijkstra.step(debug));
+    patchQueryGraph(*baseQueryGraph, basePatchedEdges, nullptr);
+    biDirectionalDijkstra.queryGraph = sharedQueryGraph;
+}
+
+template<typename WeightType>
+void OptimizedKit::CchQuery<WeightType>::patchQueryGraph(CchQueryGraph<WeightType> &queryGraph,
+                                                         std::vector<EdgeId> &patched,
+                                                         const CchMetricOverlay<WeightType> *patchOverlay) {
+    assert(!cchPreprocessor->hasCompressedTopology() && "Overlays and blocked edges need the uncompressed topology.");
+
+    // Restore the previously patched arcs to the base metric, then overwrite the arcs changed by the overlay.
+    const auto &upwardsGraph = cchPreprocessor->upwardsGraph;
+    auto arcOf = [&](EdgeId edge) -> CchQueryArc<WeightType> & {
+        VertexId x = upwardsGraph.tail[edge];
+        auto &arc = queryGraph.arcs[queryGraph.arcRanges[x].begin + edge - upwardsGraph.adjacencyIndices[x]];
+        assert(arc.cchEdge == edge);
+        return arc;
+    };
+    for (auto edge: patched) {
+        arcOf(edge).forwardWeight = cchCustomizer->forwardWeights[edge];
+        arcOf(edge).backwardWeight = cchCustomizer->backwardWeights[edge];
+    }
+    patched.clear();
+    if (patchOverlay == nullptr)
+        return;
+    for (const auto &[edge, weights]: patchOverlay->getChangedEdgeWeights()) {
+        arcOf(edge).forwardWeight = weights.first;
+        arcOf(edge).backwardWeight = weights.second;
+        patched.push_back(edge);
+    }
+}
+
+template<typename WeightType>
+const OptimizedKit::CchMetricOverlay<WeightType> *OptimizedKit::CchQuery<WeightType>::activeOverlay() const {
+    return isBlockedOverlayActive ? &blockedOverlay : metricOverlay;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::readsCustomizerMetric() const {
+    return activeOverlay() == nullptr && quantizedMetric == nullptr;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::forwardWeightOf(EdgeId cchEdge) const {
+    if (quantizedMetric != nullptr)
+        return quantizedMetric->forwardWeight(cchEdge);
+    const auto *readOverlay = activeOverlay();
+    return readOverlay != nullptr ? readOverlay->forwardWeight(cchEdge) : cchCustomizer->forwardWeights[cchEdge];
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::backwardWeightOf(EdgeId cchEdge) const {
+    if (quantizedMetric != nullptr)
+        return quantizedMetric->backwardWeight(cchEdge);
+    const auto *readOverlay = activeOverlay();
+    return readOverlay != nullptr ? readOverlay->backwardWeight(cchEdge) : cchCustomizer->backwardWeights[cchEdge];
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::inputWeightOf(EdgeId inputEdge) const {
+    if (quantizedMetric != nullptr)
+        return quantizedMetric->inputWeight(inputEdge);
+    const auto *readOverlay = activeOverlay();
+    return readOverlay != nullptr ? readOverlay->inputWeight(inputEdge) : cchCustomizer->inputWeights[inputEdge];
+}
+
+template<typename WeightType>
+OptimizedKit::CchQueryGraph<WeightType> &
+OptimizedKit::CchQuery<WeightType>::packPrivateQueryGraph(const std::vector<WeightType> &forwardWeights,
+                                                          const std::vector<WeightType> &backwardWeights) {
+    assert(!cchPreprocessor->hasCompressedTopology() && "Overlays and blocked edges need the uncompressed topology.");
+    if (!privateQueryGraph) {
+        privateQueryGraph = std::make_shared<CchQueryGraph<WeightType>>();
+        privateQueryGraph->setHugePagePolicy(hugePagePolicy);
+    }
+    patchedEdges.clear();
+    patchedOverlay = nullptr;
+    return privateQueryGraph->build(CchGraph<WeightType>(&cchPreprocessor->upwardsGraph, &forwardWeights,
+                                                         &backwardWeights, cchPreprocessor->cchVertexCount()));
+}
+
+template<typename WeightType>
+void OptimizedKit::CchQuery<WeightType>::refreshQueryGraph() {
+    assert((metricOverlay == nullptr || !metricOverlay->isStale()) && "The metric overlay must be refreshed.");
+    assert((quantizedMetric == nullptr || (metricOverlay == nullptr && blockedInputEdges.empty())) &&
+           "Quantized metrics are queried without overlays and blocked edges.");
+
+    // A quantized snapshot is searched on its quantized weights, the customizer may hold another metric by now.
+    if (quantizedMetric != nullptr) {
+        if (searchedQuantizedMetric != quantizedMetric) {
+            biDirectionalDijkstra.quantizedQueryGraph = quantizedMetric->getQueryGraph();
+            searchedQuantizedMetric = quantizedMetric;
+        }
+        return;
+    }
+    biDirectionalDijkstra.quantizedQueryGraph.reset();
+    searchedQuantizedMetric = nullptr;
+
+    // The shared metric is searched on the query graph of the customizer, a newer metric is fetched once.
+    if (metricOverlay == nullptr) {
+        if (metricVersion != cchCustomizer->metricVersion || biDirectionalDijkstra.queryGraph == privateQueryGraph) {
+            biDirectionalDijkstra.queryGraph = cchCustomizer->getQueryGraph();
+            metricVersion = cchCustomizer->metricVersion;
+        }
+        return;
+    }
+
+    // Overlays always apply to the base metric, repack the private graph if the base metric changed since.
+    if (!privateQueryGraph || privateQueryGraphMetricVersion != cchCustomizer->metricVersion) {
+        packPrivateQueryGraph(cchCustomizer->forwardWeights, cchCustomizer->backwardWeights);
+        privateQueryGraphMetricVersion = cchCustomizer->metricVersion;
+    }
+
+    // Copy the changed arcs of the personalized metric, only its footprint is written.
+    auto metricOverlayVersion = metricOverlay->getVersion();
+    if (patchedOverlay != metricOverlay || patchedOverlayVersion != metricOverlayVersion) {
+        patchQueryGraph(*privateQueryGraph, patchedEdges, metricOverlay);
+        patchedOverlay = metricOverlay;
+        patchedOverlayVersion = metricOverlayVersion;
+    }
+    biDirectionalDijkstra.queryGraph = privateQueryGraph;
+}
+
 template<typename WeightType>
 OptimizedKit::EdgeId OptimizedKit::CchQuery<WeightType>::unpackForwardOriginalEdge(EdgeId cchEdge) {
-    auto i = cchPreprocessor->doesCchEdgeHaveInputEdgeMapper.toLocal(cchEdge);
+    auto i = cchPreprocessor->doesCchEdgeHaveInputEdge.rank(cchEdge);
 
     if (cchPreprocessor->forwardInputEdgeOfCchEdge[i] == INVALID_VALUE < VertexId >)
         return INVALID_VALUE<EdgeId>;
 
     EdgeId originalEdge = cchPreprocessor->forwardInputEdgeOfCchEdge[i];
-    if (cchCustomizer->forwardWeights[cchEdge] == cchCustomizer->inputWeights[originalEdge])
+    if (forwardWeightOf(cchEdge) == inputWeightOf(originalEdge) && hasInputAttributes(true, cchEdge, originalEdge))
         return originalEdge;
 
     if (cchPreprocessor->doesCchEdgeHaveExtraInputEdge[cchEdge]) {
-        auto j = cchPreprocessor->doesCchEdgeHaveExtraInputEdgeMapper.toLocal(cchEdge);
+        auto j = cchPreprocessor->doesCchEdgeHaveExtraInputEdge.rank(cchEdge);
         for (auto k = cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[j];
              k < cchPreprocessor->extraForwardInputEdgeOfCchAdjacencyEdges[j + 1]; ++k) {
             originalEdge = cchPreprocessor->extraForwardInputEdgeOfCch[k];
-            if (cchCustomizer->forwardWeights[cchEdge] == cchCustomizer->inputWeights[originalEdge])
+            if (forwardWeightOf(cchEdge) == inputWeightOf(originalEdge) && hasInputAttributes(true, cchEdge, originalEdge))
                 return originalEdge;
         }
     }
@@ -71,27 +421,51 @@ OptimizedKit::EdgeId OptimizedKit::CchQuery<WeightType>::unpackForwardOriginalEd
 
 template<typename WeightType>
 OptimizedKit::EdgeId OptimizedKit::CchQuery<WeightType>::unpackBackwardOriginalEdge(EdgeId cchEdge) {
-    auto i = cchPreprocessor->doesCchEdgeHaveInputEdgeMapper.toLocal(cchEdge);
+    auto i = cchPreprocessor->doesCchEdgeHaveInputEdge.rank(cchEdge);
 
     if (cchPreprocessor->backwardInputEdgeOfCchEdge[i] == INVALID_VALUE < VertexId >)
         return INVALID_VALUE<EdgeId>;
 
     EdgeId originalEdge = cchPreprocessor->backwardInputEdgeOfCchEdge[i];
-    if (cchCustomizer->backwardWeights[cchEdge] == cchCustomizer->inputWeights[originalEdge])
+    if (backwardWeightOf(cchEdge) == inputWeightOf(originalEdge) && hasInputAttributes(false, cchEdge, originalEdge))
         return originalEdge;
 
     if (cchPreprocessor->doesCchEdgeHaveExtraInputEdge[cchEdge]) {
-        auto j = cchPreprocessor->doesCchEdgeHaveExtraInputEdgeMapper.toLocal(cchEdge);
+        auto j = cchPreprocessor->doesCchEdgeHaveExtraInputEdge.rank(cchEdge);
         for (auto k = cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[j];
              k < cchPreprocessor->extraBackwardInputEdgeOfCchAdjacencyEdges[j + 1]; ++k) {
             originalEdge = cchPreprocessor->extraBackwardInputEdgeOfCch[k];
-            if (cchCustomizer->backwardWeights[cchEdge] == cchCustomizer->inputWeights[originalEdge])
+            if (backwardWeightOf(cchEdge) == inputWeightOf(originalEdge) && hasInputAttributes(false, cchEdge, originalEdge))
                 return originalEdge;
         }
     }
     return INVALID_VALUE<EdgeId>;
 }
 
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::hasTightAttributes(bool forward, EdgeId ab, EdgeId ac, EdgeId bc) const {
+    // Prefer the triangle the secondary attributes were taken from, personalized metrics carry no attributes.
+    auto attributeCount = cchCustomizer->secondaryAttributeCount();
+    if (attributeCount == 0 || !readsCustomizerMetric())
+        return true;
+    const auto &bcAttributes = forward ? cchCustomizer->forwardAttributes : cchCustomizer->backwardAttributes;
+    const auto &abAttributes = forward ? cchCustomizer->backwardAttributes : cchCustomizer->forwardAttributes;
+    for (unsigned k = 0; k < attributeCount; ++k)
+        if (bcAttributes[bc * attributeCount + k] != abAttributes[ab * attributeCount + k] + bcAttributes[ac * attributeCount + k])
+            return false;
+    return true;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::hasInputAttributes(bool forward, EdgeId cchEdge, EdgeId inputEdge) const {
+    auto attributeCount = cchCustomizer->secondaryAttributeCount();
+    if (attributeCount == 0 || !readsCustomizerMetric())
+        return true;
+    const auto &attributes = forward ? cchCustomizer->forwardAttributes : cchCustomizer->backwardAttributes;
+    return std::equal(attributes.begin() + cchEdge * attributeCount, attributes.begin() + (cchEdge + 1) * attributeCount,
+                      cchCustomizer->inputAttributes.begin() + inputEdge * attributeCount);
+}
+
 template<typename WeightType>
 OptimizedKit::EdgeId OptimizedKit::CchQuery<WeightType>::unpackOriginalEdge(EdgeId cchEdge, bool forward) {
     if (!cchPreprocessor->doesCchEdgeHaveInputEdge[cchEdge])
@@ -107,20 +481,16 @@ template<class OnMissingFound>
 void OptimizedKit::CchQuery<WeightType>::unpackLowerTriangles(bool forward, VertexId b, VertexId c, EdgeId bc,
                                                               const OnMissingFound &onMissingFound) {
     assert(bc != INVALID_VALUE < EdgeId >);
-    assert(b == cchPreprocessor->upwardsGraph.tail[bc]);
-    assert(c == cchPreprocessor->upwardsGraph.head[bc]);
+    assert(cchPreprocessor->findUpwardsEdge(b, c) == bc);
 
     // Identify if the triangle was relaxed used in the shortest distance computation.
     VertexId a = INVALID_VALUE<VertexId>;
     EdgeId ab = INVALID_VALUE<EdgeId>;
     EdgeId ac = INVALID_VALUE<EdgeId>;
-    auto unpacker = [&](EdgeId ab_, EdgeId ac_, EdgeId bc_, VertexId a_, VertexId b_, VertexId c_) {
-        if ((forward
-                && cchCustomizer->forwardWeights[bc_] ==
-                    cchCustomizer->backwardWeights[ab_] + cchCustomizer->forwardWeights[ac_])
-            || (!forward
-                && cchCustomizer->backwardWeights[bc_] ==
-                    cchCustomizer->forwardWeights[ab_] + cchCustomizer->backwardWeights[ac_])) {
+    auto unpacker = [&](EdgeId ab_, EdgeId ac_, EdgeId bc_, VertexId a_, VertexId, VertexId) {
+        if (((forward && forwardWeightOf(bc_) == Traits::add(backwardWeightOf(ab_), forwardWeightOf(ac_))) ||
+             (!forward && backwardWeightOf(bc_) == Traits::add(forwardWeightOf(ab_), backwardWeightOf(ac_)))) &&
+            hasTightAttributes(forward, ab_, ac_, bc_)) {
             a = a_;
             ab = ab_;
             ac = ac_;
@@ -137,14 +507,104 @@ void OptimizedKit::CchQuery<WeightType>::unpackLowerTriangles(bool forward, Vert
     }
 
     // Recursively identify the next lower triangles with missing vertices.
-    unpackLowerTriangles(!forward, a, forward ? b : c, forward ? ab : ac, onMissingFound);
-    unpackLowerTriangles(forward, a, forward ? c : b, forward ? ac : ab, onMissingFound);
+    unpackLowerTriangles(false, a, forward ? b : c, forward ? ab : ac, onMissingFound);
+    unpackLowerTriangles(true, a, forward ? c : b, forward ? ac : ab, onMissingFound);
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchQuery<WeightType>::searchedArcWeight(VertexId a, VertexId x, EdgeId ax, bool forward) const {
+    // The shared graph of a perfect metric was searched on its pruned arcs, pruned arcs are missing from it.
+    if (!readsCustomizerMetric() || cchCustomizer->getState() != CustomizerState::PERFECT_CUSTOMIZED)
+        return forward ? forwardWeightOf(ax) : backwardWeightOf(ax);
+    const auto *arc = biDirectionalDijkstra.queryGraph->findArc(a, x);
+    return arc == nullptr ? INFINITY_WEIGHT<WeightType> : forward ? arc->forwardWeight : arc->backwardWeight;
+}
+
+template<typename WeightType>
+OptimizedKit::VertexId OptimizedKit::CchQuery<WeightType>::recoverPredecessor(VertexId x, bool forward) {
+    const auto &distance = forward ? biDirectionalDijkstra.forwardDistance : biDirectionalDijkstra.backwardDistance;
+
+    // Any lower neighbour whose distance plus the arc weight is tight lies on a shortest path to x.
+    VertexId predecessor = INVALID_VALUE<VertexId>;
+    cchPreprocessor->forEachDownwardsEdge(x, [&](EdgeId xa, VertexId a) {
+        if (predecessor != INVALID_VALUE<VertexId> || Traits::isInfinite(distance[a]))
+            return;
+        EdgeId ax = cchPreprocessor->downwardsToUpwardsGraph[xa];
+        if (Traits::add(distance[a], searchedArcWeight(a, x, ax, forward)) == distance[x])
+            predecessor = a;
+    });
+    return predecessor;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::usesAttributedPaths() const {
+    return cchCustomizer->secondaryAttributeCount() != 0 && readsCustomizerMetric();
+}
+
+template<typename WeightType>
+void OptimizedKit::CchQuery<WeightType>::selectArcAttributes() {
+    // Ties are broken by the secondary attributes the metric of the customizer carries.
+    if (usesAttributedPaths())
+        biDirectionalDijkstra.setArcAttributes(cchCustomizer->secondaryAttributeCount(),
+                                               cchCustomizer->forwardAttributes.data(),
+                                               cchCustomizer->backwardAttributes.data());
+    else
+        biDirectionalDijkstra.setArcAttributes(0, nullptr, nullptr);
+}
+
+template<typename WeightType>
+std::vector<OptimizedKit::VertexId> OptimizedKit::CchQuery<WeightType>::recoverSearchPath(bool forward) {
+    // Walk down from the meeting vertex, using predecessors if tracked and the customized weights otherwise.
+    const auto &predecessor = forward ? biDirectionalDijkstra.forwardPredecessor : biDirectionalDijkstra.backwardPredecessor;
+    VertexId x = biDirectionalDijkstra.meetingVertex;
+    std::vector<VertexId> path{x};
+    while (!isSearchEnd(x, forward)) {
+        x = biDirectionalDijkstra.tracksPredecessors() ? predecessor[x] : recoverPredecessor(x, forward);
+        assert(x != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
+        path.push_back(x);
+    }
+    return path;
+}
+
+template<typename WeightType>
+bool OptimizedKit::CchQuery<WeightType>::isSearchEnd(VertexId x, bool forward) {
+    // A seed ends the search path if its initial distance is tight, otherwise it was reached via another seed.
+    const auto &seeds = forward ? localSources : localTargets;
+    const auto &distance = forward ? biDirectionalDijkstra.forwardDistance : biDirectionalDijkstra.backwardDistance;
+    for (const auto &[seed, offset]: seeds)
+        if (seed == x && offset == distance[x])
+            return true;
+    return false;
+}
+
+template<typename WeightType>
+template<class OnMissingFound>
+void OptimizedKit::CchQuery<WeightType>::unpackPath(const OnMissingFound &onMissingFound) {
+    // Path source -> meeting node.
+    auto forwardPath = recoverSearchPath(true);
+    for (auto i = forwardPath.size() - 1; i != 0; --i) {
+        unpackLowerTriangles(true, forwardPath[i], forwardPath[i - 1],
+                             cchPreprocessor->findUpwardsEdge(forwardPath[i], forwardPath[i - 1]),
+                             onMissingFound);
+    }
+
+    // Path meeting node -> target.
+    auto backwardPath = recoverSearchPath(false);
+    for (std::size_t i = 0; i + 1 < backwardPath.size(); ++i) {
+        unpackLowerTriangles(false, backwardPath[i + 1], backwardPath[i],
+                             cchPreprocessor->findUpwardsEdge(backwardPath[i + 1], backwardPath[i]),
+                             onMissingFound);
+    }
 }
 
 template<typename WeightType>
 std::vector<OptimizedKit::EdgeId> OptimizedKit::CchQuery<WeightType>::getEdgePath() {
     assert(state == QueryState::FINISHED);
     edgePath.clear();
+    if (isSameEdgePath) {
+        edgePath.push_back(sourceEdge);
+        return edgePath;
+    }
 
     // Check success of Dijkstra.
     if (getQueryWeight() == INFINITY_WEIGHT < WeightType > ||
@@ -152,54 +612,16 @@ std::vector<OptimizedKit::EdgeId> OptimizedKit::CchQuery<WeightType>::getEdgePat
         return edgePath;
     }
 
-    auto onMissingEdgeFound = [&](VertexId cchVertex, EdgeId cchEdge, bool forward) {
+    if (sourceEdge != INVALID_VALUE<EdgeId>)
+        edgePath.push_back(sourceEdge);
+    unpackPath([&](VertexId cchVertex, EdgeId cchEdge, bool forward) {
         (void) cchVertex;
         EdgeId edge = unpackOriginalEdge(cchEdge, forward);
         assert(edge != INVALID_VALUE < EdgeId >);
         edgePath.push_back(edge);
-    };
-
-    // Path source -> meeting node.
-    {
-        std::vector<VertexId> forwardVertexPath;
-        VertexId x = biDirectionalDijkstra.meetingVertex;
-        while (x != localSource) {
-            forwardVertexPath.push_back(x);
-            x = biDirectionalDijkstra.forwardPredecessor[x];
-            assert(x != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-        }
-        forwardVertexPath.push_back(localSource);
-
-        // Convert local vertex id path to global edge id path, source -> meeting point.
-        for (unsigned i = forwardVertexPath.size() - 1; i != 0; --i) {
-            unpackLowerTriangles(true, forwardVertexPath[i], forwardVertexPath[i - 1],
-                                 findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                          cchPreprocessor->upwardsGraph.head, forwardVertexPath[i],
-                                          forwardVertexPath[i - 1]), onMissingEdgeFound);
-        }
-    }
-
-    // Path meeting node -> target.
-    {
-        VertexId c = biDirectionalDijkstra.meetingVertex;
-        if (c == localTarget)
-            return edgePath;
-        VertexId b = biDirectionalDijkstra.backwardPredecessor[c];
-        assert(b != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-
-        // Instantly convert local vertex id path to global edge id path, meeting point -> target.
-        while (b != localTarget) {
-            unpackLowerTriangles(false, b, c, findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                                       cchPreprocessor->upwardsGraph.head, b, c),
-                                 onMissingEdgeFound);
-            c = b;
-            assert(b != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-            b = biDirectionalDijkstra.backwardPredecessor[b];
-        }
-        unpackLowerTriangles(false, b, c, findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                                   cchPreprocessor->upwardsGraph.head, b, c),
-                             onMissingEdgeFound);
-    }
+    });
+    if (targetEdge != INVALID_VALUE<EdgeId>)
+        edgePath.push_back(targetEdge);
     return edgePath;
 }
 
@@ -208,74 +630,160 @@ std::vector<OptimizedKit::VertexId> OptimizedKit::CchQuery<WeightType>::getVerte
     assert(state == QueryState::FINISHED);
     vertexPath.clear();
 
+    // A path along a single edge passes no vertex.
+    if (isSameEdgePath)
+        return vertexPath;
+
     // Check success of Dijkstra.
     if (getQueryWeight() == INFINITY_WEIGHT < WeightType > ||
         biDirectionalDijkstra.meetingVertex == INVALID_VALUE < VertexId >) {
         return vertexPath;
     }
 
-    auto onMissingVertexFound = [&](VertexId cchVertex, EdgeId cchEdge, bool forward) {
+    unpackPath([&](VertexId cchVertex, EdgeId cchEdge, bool forward) {
         (void) cchEdge;
         (void) forward;
         vertexPath.push_back(cchPreprocessor->order[cchVertex]);
-    };
+    });
+    vertexPath.push_back(cchPreprocessor->order[localTarget]);
+    return vertexPath;
+}
 
-    // Path source -> meeting node.
-    {
-        std::vector<VertexId> localForwardPath;
-        VertexId x = biDirectionalDijkstra.meetingVertex;
-        while (x != localSource) {
-            localForwardPath.push_back(x);
-            x = biDirectionalDijkstra.forwardPredecessor[x];
-            assert(x != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-        }
-        localForwardPath.push_back(localSource);
-
-        // Convert local vertex id path to global vertex id path, source -> meeting point.
-        for (unsigned i = localForwardPath.size() - 1; i != 0; --i) {
-            unpackLowerTriangles(true, localForwardPath[i], localForwardPath[i - 1],
-                                 findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                          cchPreprocessor->upwardsGraph.head, localForwardPath[i],
-                                          localForwardPath[i - 1]), onMissingVertexFound);
+template<typename WeightType>
+std::vector<WeightType> OptimizedKit::CchQuery<WeightType>::getSecondaryTotals() {
+    assert(state == QueryState::FINISHED);
+    std::vector<WeightType> totals;
+    if (!isSameEdgePath && (getQueryWeight() == INFINITY_WEIGHT<WeightType> ||
+                            biDirectionalDijkstra.meetingVertex == INVALID_VALUE<VertexId>))
+        return totals;
+
+    auto attributeCount = cchCustomizer->secondaryAttributeCount();
+    const auto &inputAttributes = cchCustomizer->inputAttributes;
+    totals.assign(attributeCount, WeightType{});
+    auto addAttributes = [&](const WeightType *attributes) {
+        for (unsigned k = 0; k < attributeCount; ++k)
+            totals[k] += attributes[k];
+    };
+    if (isSameEdgePath) {
+        for (unsigned k = 0; k < attributeCount; ++k) {
+            auto attribute = inputAttributes[sourceEdge * attributeCount + k];
+            totals[k] = partialValue(attribute, targetOffset) - partialValue(attribute, sourceOffset);
         }
+        return totals;
     }
 
-    // Path meeting node -> target.
-    {
-        VertexId c = biDirectionalDijkstra.meetingVertex;
-        if (c == localTarget) {
-            vertexPath.push_back(cchPreprocessor->order[c]);
-            return vertexPath;
-        }
-        VertexId b = biDirectionalDijkstra.backwardPredecessor[c];
-        assert(b != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-
-        // Instantly convert local vertex id path to global vertex id path, meeting point -> target.
-        while (b != localTarget) {
-            unpackLowerTriangles(false, b, c, findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                                       cchPreprocessor->upwardsGraph.head, b, c),
-                                 onMissingVertexFound);
-            c = b;
-            b = biDirectionalDijkstra.backwardPredecessor[b];
-            assert(b != INVALID_VALUE < VertexId > && "Invalid predecessor found.");
-        }
-        unpackLowerTriangles(false, b, c, findEdge(cchPreprocessor->upwardsGraph.adjacencyIndices,
-                                                   cchPreprocessor->upwardsGraph.head, b, c),
-                             onMissingVertexFound);
-        vertexPath.push_back(cchPreprocessor->order[b]);
+    if (!readsCustomizerMetric()) {
+        // The attributes of the shared metric do not match a personalized metric, sum the unpacked input edges instead.
+        unpackPath([&](VertexId cchVertex, EdgeId cchEdge, bool forward) {
+            (void) cchVertex;
+            addAttributes(&inputAttributes[unpackOriginalEdge(cchEdge, forward) * attributeCount]);
+        });
+    } else {
+        // Sum the attributes of the cch arcs on both search paths, shortcuts already carry the totals they represent.
+        auto forwardPath = recoverSearchPath(true);
+        for (std::size_t i = 1; i < forwardPath.size(); ++i)
+            addAttributes(&cchCustomizer->forwardAttributes[
+                    cchPreprocessor->findUpwardsEdge(forwardPath[i], forwardPath[i - 1]) * attributeCount]);
+        auto backwardPath = recoverSearchPath(false);
+        for (std::size_t i = 1; i < backwardPath.size(); ++i)
+            addAttributes(&cchCustomizer->backwardAttributes[
+                    cchPreprocessor->findUpwardsEdge(backwardPath[i], backwardPath[i - 1]) * attributeCount]);
     }
-    return vertexPath;
+
+    // Positions on edges add the travelled parts of the source and target edges.
+    for (unsigned k = 0; k < attributeCount && sourceEdge != INVALID_VALUE<EdgeId>; ++k) {
+        auto attribute = inputAttributes[sourceEdge * attributeCount + k];
+        totals[k] += attribute - partialValue(attribute, sourceOffset);
+    }
+    for (unsigned k = 0; k < attributeCount && targetEdge != INVALID_VALUE<EdgeId>; ++k)
+        totals[k] += partialValue(inputAttributes[targetEdge * attributeCount + k], targetOffset);
+    return totals;
 }
 
 template<typename WeightType>
 WeightType OptimizedKit::CchQuery<WeightType>::getQueryWeight() {
     assert(state == QueryState::FINISHED);
+    if (isSameEdgePath)
+        return sameEdgeWeight;
     if (biDirectionalDijkstra.meetingVertex == INVALID_VALUE < VertexId >)
         return INFINITY_WEIGHT<WeightType>;
     return biDirectionalDijkstra.shortestPathLength;
 }
 
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &OptimizedKit::CchQuery<WeightType>::setQueryMode(QueryMode mode) {
+    biDirectionalDijkstra.queryMode = mode;
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::VertexId OptimizedKit::CchQuery<WeightType>::getSource() {
+    assert(state == QueryState::FINISHED);
+    return globalSource;
+}
+
+template<typename WeightType>
+OptimizedKit::VertexId OptimizedKit::CchQuery<WeightType>::getTarget() {
+    assert(state == QueryState::FINISHED);
+    return globalTarget;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &OptimizedKit::CchQuery<WeightType>::setBlockedEdges(std::vector<EdgeId> inputEdges) {
+    std::sort(inputEdges.begin(), inputEdges.end());
+    inputEdges.erase(std::unique(inputEdges.begin(), inputEdges.end()), inputEdges.end());
+    if (inputEdges != blockedInputEdges)
+        isBlockedOverlayBuilt = false;
+    blockedInputEdges = std::move(inputEdges);
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &
+OptimizedKit::CchQuery<WeightType>::setMetricOverlay(const CchMetricOverlay<WeightType> *overlay) {
+    assert((overlay == nullptr || &overlay->getCustomizer() == cchCustomizer) && "Overlay of another customizer.");
+    metricOverlay = overlay;
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &
+OptimizedKit::CchQuery<WeightType>::setQuantizedMetric(const CchQuantizedMetric<WeightType> *metric) {
+    assert((metric == nullptr || metric->cchPreprocessor == cchPreprocessor) && "Snapshot of another preprocessor.");
+    quantizedMetric = metric;
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQuery<WeightType> &OptimizedKit::CchQuery<WeightType>::setHugePagePolicy(HugePagePolicy policy) {
+    hugePagePolicy = policy;
+    if (privateQueryGraph)
+        privateQueryGraph->setHugePagePolicy(policy);
+    if (baseQueryGraph)
+        baseQueryGraph->setHugePagePolicy(policy);
+    return *this;
+}
+
 template<typename WeightType>
 OptimizedKit::QueryState OptimizedKit::CchQuery<WeightType>::getState() {
     return state;
 }
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchQuery<WeightType>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("vertexPath", vertexPath)
+         .add("edgePath", edgePath)
+         .add("localSources", localSources)
+         .add("localTargets", localTargets)
+         .add("patchedEdges", patchedEdges)
+         .add("blockedInputEdges", blockedInputEdges)
+         .add("basePatchedEdges", basePatchedEdges)
+         .add("biDirectionalDijkstra", biDirectionalDijkstra.memoryUsage())
+         .add("blockedOverlay", blockedOverlay.memoryUsage());
+    if (privateQueryGraph)
+        usage.add("privateQueryGraph", privateQueryGraph->memoryUsage());
+    if (baseQueryGraph)
+        usage.add("baseQueryGraph", baseQueryGraph->memoryUsage());
+    return usage;
+}
@@ -0,0 +1,76 @@
+#include <customizable_contraction_hierarchy/cch_serving_index.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchServingIndex<WeightType>::CchServingIndex(CchPreprocessor &&preprocessor_,
+                                                           CchCustomizer<WeightType> &&customizer_,
+                                                           bool compressTopology)
+        : preprocessor(std::move(preprocessor_)),
+          inputWeights(customizer_.inputWeights, customizer_.inputWeights + preprocessor.inputEdgeTail.size()),
+          customizer(std::move(customizer_)) {
+    assert(customizer.getState() != CustomizerState::UNCUSTOMIZED && "Only a customized metric can be frozen.");
+
+    // Re-point the customizer to the moved preprocessor and the owned input weights before releasing anything.
+    customizer.cchPreprocessor = &preprocessor;
+    customizer.inputWeights = inputWeights.data();
+    customizer.releaseUpdateState();
+    preprocessor.releasePreprocessingState();
+
+    // Pack the shared query graph up front, queries of the index only ever read it.
+    (void) customizer.getQueryGraph();
+    if (compressTopology)
+        preprocessor.compressTopology();
+}
+
+template<typename WeightType>
+OptimizedKit::CchServingIndex<WeightType>::CchServingIndex(const CchServingIndex &other)
+        : preprocessor(other.preprocessor), inputWeights(other.inputWeights), customizer(other.customizer) {
+    customizer.cchPreprocessor = &preprocessor;
+    customizer.inputWeights = inputWeights.data();
+    customizer.sharedQueryGraph.graph = std::make_shared<CchQueryGraph<WeightType>>(*other.customizer.getQueryGraph());
+}
+
+template<typename WeightType>
+std::size_t OptimizedKit::CchServingIndex<WeightType>::adviseHugePages(HugePagePolicy policy) const {
+    return preprocessor.adviseHugePages(policy) + OptimizedKit::adviseHugePages(inputWeights, policy) +
+           customizer.adviseHugePages(policy);
+}
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchServingIndex<WeightType>::memoryUsage() const {
+    MemoryUsage usage;
+
+    // Topology and the mapping between input and cch ids.
+    usage.add("order", preprocessor.order)
+         .add("rank", preprocessor.rank)
+         .add("inputEdgeTail", preprocessor.inputEdgeTail)
+         .add("inputEdgeHead", preprocessor.inputEdgeHead)
+         .add("upwardsGraph", preprocessor.upwardsGraph.memoryUsage())
+         .add("downwardsGraph", preprocessor.downwardsGraph.memoryUsage())
+         .add("compressedUpwardsGraph", preprocessor.compressedUpwardsGraph.memoryUsage())
+         .add("compressedDownwardsGraph", preprocessor.compressedDownwardsGraph.memoryUsage())
+         .add("downwardsToUpwardsGraph", preprocessor.downwardsToUpwardsGraph);
+
+    // Unpacking of cch edges to input edges.
+    usage.add("doesCchEdgeHaveInputEdge", preprocessor.doesCchEdgeHaveInputEdge.memoryUsage())
+         .add("forwardInputEdgeOfCchEdge", preprocessor.forwardInputEdgeOfCchEdge)
+         .add("backwardInputEdgeOfCchEdge", preprocessor.backwardInputEdgeOfCchEdge)
+         .add("doesCchEdgeHaveExtraInputEdge", preprocessor.doesCchEdgeHaveExtraInputEdge.memoryUsage())
+         .add("extraForwardInputEdgeOfCchAdjacencyEdges", preprocessor.extraForwardInputEdgeOfCchAdjacencyEdges)
+         .add("extraBackwardInputEdgeOfCchAdjacencyEdges", preprocessor.extraBackwardInputEdgeOfCchAdjacencyEdges)
+         .add("extraForwardInputEdgeOfCch", preprocessor.extraForwardInputEdgeOfCch)
+         .add("extraBackwardInputEdgeOfCch", preprocessor.extraBackwardInputEdgeOfCch);
+
+    // Metric.
+    usage.add("inputWeights", inputWeights)
+         .add("forwardWeights", customizer.forwardWeights)
+         .add("backwardWeights", customizer.backwardWeights)
+         .add("inputAttributes", customizer.inputAttributes)
+         .add("forwardAttributes", customizer.forwardAttributes)
+         .add("backwardAttributes", customizer.backwardAttributes)
+         .add("stronglyConnectedComponent", customizer.stronglyConnectedComponent)
+         .add("weaklyConnectedComponent", customizer.weaklyConnectedComponent);
+
+    // Packed query graph searched by all queries of the index.
+    usage.add("queryGraph", customizer.getQueryGraph()->memoryUsage());
+    return usage;
+}
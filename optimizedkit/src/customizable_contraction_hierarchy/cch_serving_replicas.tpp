@@ -0,0 +1,46 @@
+#include <customizable_contraction_hierarchy/cch_serving_replicas.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchServingReplicas<WeightType>::CchServingReplicas(const CchServingIndex<WeightType> &index,
+                                                                 std::vector<std::vector<unsigned>> cpusOfReplica_,
+                                                                 HugePagePolicy hugePagePolicy)
+        : cpusOfReplica(std::move(cpusOfReplica_)), replicas(cpusOfReplica.size()) {
+    assert(!cpusOfReplica.empty() && "At least one replica is required.");
+
+    // Copy each replica on its own node concurrently, huge pages are collapsed there as well. The index is only read.
+    std::vector<std::thread> copiers;
+    for (std::size_t r = 0; r < replicas.size(); ++r) {
+        copiers.emplace_back([&, r] {
+            pinCurrentThread(cpusOfReplica[r]);
+            replicas[r] = std::make_unique<CchServingIndex<WeightType>>(index);
+            replicas[r]->adviseHugePages(hugePagePolicy);
+        });
+    }
+    for (auto &copier: copiers)
+        copier.join();
+}
+
+template<typename WeightType>
+const OptimizedKit::CchServingIndex<WeightType> &
+OptimizedKit::CchServingReplicas<WeightType>::bindCurrentThread(std::size_t r) const {
+    assert(r < replicas.size());
+    pinCurrentThread(cpusOfReplica[r]);
+    return *replicas[r];
+}
+
+template<typename WeightType>
+std::size_t OptimizedKit::CchServingReplicas<WeightType>::replicaOfCurrentThread() const {
+    auto cpu = currentCpu();
+    for (std::size_t r = 0; r < cpusOfReplica.size(); ++r)
+        if (std::find(cpusOfReplica[r].begin(), cpusOfReplica[r].end(), cpu) != cpusOfReplica[r].end())
+            return r;
+    return 0;
+}
+
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::CchServingReplicas<WeightType>::memoryUsage() const {
+    MemoryUsage usage;
+    for (std::size_t r = 0; r < replicas.size(); ++r)
+        usage.add("replica" + std::to_string(r), replicas[r]->memoryUsage());
+    return usage;
+}
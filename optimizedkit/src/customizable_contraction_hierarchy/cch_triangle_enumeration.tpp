@@ -2,8 +2,12 @@
 
 template<class F>
 void OptimizedKit::enumerateUpperTriangles(const CchPreprocessor &preprocessor, EdgeId ab, const F &f) {
-    VertexId a = preprocessor.upwardsGraph.tail[ab];
-    VertexId b = preprocessor.upwardsGraph.head[ab];
+    VertexId a = preprocessor.upwardsTail(ab);
+    VertexId b = preprocessor.upwardsHead(ab);
+    if (preprocessor.hasCompressedTopology()) {
+        enumerateCompressedUpperTriangles(preprocessor, ab, a, b, f);
+        return;
+    }
 
     EdgeId aUp = ab + 1;
     EdgeId bUp = preprocessor.upwardsGraph.adjacencyIndices[b];
@@ -26,8 +30,12 @@ void OptimizedKit::enumerateUpperTriangles(const CchPreprocessor &preprocessor,
 
 template<class F>
 void OptimizedKit::enumerateIntermediateTriangles(const CchPreprocessor &preprocessor, EdgeId ac, const F &f) {
-    VertexId a = preprocessor.upwardsGraph.tail[ac];
-    VertexId c = preprocessor.upwardsGraph.head[ac];
+    VertexId a = preprocessor.upwardsTail(ac);
+    VertexId c = preprocessor.upwardsHead(ac);
+    if (preprocessor.hasCompressedTopology()) {
+        enumerateCompressedIntermediateTriangles(preprocessor, ac, a, c, f);
+        return;
+    }
 
     EdgeId aUp = preprocessor.upwardsGraph.adjacencyIndices[a];
     EdgeId cDown = preprocessor.downwardsGraph.adjacencyIndices[c];
@@ -50,8 +58,12 @@ void OptimizedKit::enumerateIntermediateTriangles(const CchPreprocessor &preproc
 
 template<class F>
 void OptimizedKit::enumerateLowerTriangles(const CchPreprocessor &preprocessor, EdgeId bc, const F &f) {
-    VertexId b = preprocessor.upwardsGraph.tail[bc];
-    VertexId c = preprocessor.upwardsGraph.head[bc];
+    VertexId b = preprocessor.upwardsTail(bc);
+    VertexId c = preprocessor.upwardsHead(bc);
+    if (preprocessor.hasCompressedTopology()) {
+        enumerateCompressedLowerTriangles(preprocessor, bc, b, c, f);
+        return;
+    }
 
     EdgeId bDown = preprocessor.downwardsGraph.adjacencyIndices[b];
     EdgeId cDown = preprocessor.downwardsGraph.adjacencyIndices[c];
@@ -71,3 +83,71 @@ void OptimizedKit::enumerateLowerTriangles(const CchPreprocessor &preprocessor,
         }
     }
 }
+
+template<class F>
+void OptimizedKit::enumerateCompressedUpperTriangles(const CchPreprocessor &preprocessor, EdgeId ab, VertexId a,
+                                                     VertexId b, const F &f) {
+    auto aRange = preprocessor.compressedUpwardsGraph.adjacency(a);
+    auto bRange = preprocessor.compressedUpwardsGraph.adjacency(b);
+
+    // Heads are only decoded sequentially, skip the upwards edges of a up to ab.
+    auto aUp = aRange.begin();
+    while (aUp.edge() <= ab)
+        ++aUp;
+    auto bUp = bRange.begin();
+
+    while (aUp != aRange.end() && bUp != bRange.end()) {
+        if (*aUp < *bUp) {
+            ++aUp;
+        } else if (*aUp > *bUp) {
+            ++bUp;
+        } else {
+            f(ab, aUp.edge(), bUp.edge(), a, b, *aUp);
+            ++aUp;
+            ++bUp;
+        }
+    }
+}
+
+template<class F>
+void OptimizedKit::enumerateCompressedIntermediateTriangles(const CchPreprocessor &preprocessor, EdgeId ac, VertexId a,
+                                                            VertexId c, const F &f) {
+    auto aRange = preprocessor.compressedUpwardsGraph.adjacency(a);
+    auto cRange = preprocessor.compressedDownwardsGraph.adjacency(c);
+    auto aUp = aRange.begin();
+    auto cDown = cRange.begin();
+
+    while (aUp.edge() != ac && cDown != cRange.end()) {
+        if (*aUp < *cDown) {
+            ++aUp;
+        } else if (*aUp > *cDown) {
+            ++cDown;
+        } else {
+            f(aUp.edge(), ac, preprocessor.downwardsToUpwardsGraph[cDown.edge()], a, *aUp, c);
+            ++aUp;
+            ++cDown;
+        }
+    }
+}
+
+template<class F>
+void OptimizedKit::enumerateCompressedLowerTriangles(const CchPreprocessor &preprocessor, EdgeId bc, VertexId b,
+                                                     VertexId c, const F &f) {
+    auto bRange = preprocessor.compressedDownwardsGraph.adjacency(b);
+    auto cRange = preprocessor.compressedDownwardsGraph.adjacency(c);
+    auto bDown = bRange.begin();
+    auto cDown = cRange.begin();
+
+    while (bDown != bRange.end() && cDown != cRange.end()) {
+        if (*bDown < *cDown) {
+            ++bDown;
+        } else if (*bDown > *cDown) {
+            ++cDown;
+        } else {
+            f(preprocessor.downwardsToUpwardsGraph[bDown.edge()], preprocessor.downwardsToUpwardsGraph[cDown.edge()], bc,
+              *bDown, b, c);
+            ++bDown;
+            ++cDown;
+        }
+    }
+}
@@ -0,0 +1,98 @@
+#include <customizable_contraction_hierarchy/cch_turn_expansion.hpp>
+
+OptimizedKit::CchTurnExpansion::CchTurnExpansion(const Graph &graph, std::vector<Turn> restrictedTurns,
+                                                 const std::vector<Turn> &turnsWithCost) {
+    inputTail = graph.tail;
+    inputHead = graph.head;
+    const VertexId vertexCount = graph.vertexCount;
+    const EdgeId edgeCount = inputTail.size();
+    assert(std::all_of(inputTail.begin(), inputTail.end(), [&](VertexId x) { return x < vertexCount; }));
+    assert(std::all_of(inputHead.begin(), inputHead.end(), [&](VertexId x) { return x < vertexCount; }));
+
+    // Edges leaving and entering every vertex, in the order of their ids.
+    auto buildIncidence = [&](const std::vector<VertexId> &end, std::vector<EdgeId> &indices,
+                              std::vector<EdgeId> &edges) {
+        indices.assign(vertexCount + 1, 0);
+        for (EdgeId edge = 0; edge < edgeCount; ++edge)
+            ++indices[end[edge] + 1];
+        for (VertexId x = 0; x < vertexCount; ++x)
+            indices[x + 1] += indices[x];
+        edges.resize(edgeCount);
+        auto next = indices;
+        for (EdgeId edge = 0; edge < edgeCount; ++edge)
+            edges[next[end[edge]]++] = edge;
+    };
+    buildIncidence(inputTail, outEdgeIndices, outEdges);
+    buildIncidence(inputHead, inEdgeIndices, inEdges);
+
+    auto isTurn = [&](const Turn &turn) {
+        return turn.first < edgeCount && turn.second < edgeCount && inputHead[turn.first] == inputTail[turn.second];
+    };
+    assert(std::all_of(restrictedTurns.begin(), restrictedTurns.end(), isTurn));
+    assert(std::all_of(turnsWithCost.begin(), turnsWithCost.end(), isTurn));
+    (void) isTurn;
+
+    // Sorted lookup tables, costs keep the position of their turn in the input as id.
+    std::sort(restrictedTurns.begin(), restrictedTurns.end());
+    std::vector<EdgeId> costOrder(turnsWithCost.size());
+    for (EdgeId i = 0; i < costOrder.size(); ++i)
+        costOrder[i] = i;
+    std::sort(costOrder.begin(), costOrder.end(), [&](EdgeId a, EdgeId b) {
+        return turnsWithCost[a] < turnsWithCost[b];
+    });
+    assert(std::adjacent_find(costOrder.begin(), costOrder.end(), [&](EdgeId a, EdgeId b) {
+        return turnsWithCost[a] == turnsWithCost[b];
+    }) == costOrder.end() && "A turn has more than one cost.");
+    turnCostCount = turnsWithCost.size();
+
+    // Every pair of an edge into a vertex and an edge out of it is a turn unless restricted.
+    turnGraph.vertexCount = edgeCount;
+    for (VertexId x = 0; x < vertexCount; ++x) {
+        for (auto i = inEdgeIndices[x]; i < inEdgeIndices[x + 1]; ++i) {
+            for (auto j = outEdgeIndices[x]; j < outEdgeIndices[x + 1]; ++j) {
+                Turn turn{inEdges[i], outEdges[j]};
+                if (std::binary_search(restrictedTurns.begin(), restrictedTurns.end(), turn))
+                    continue;
+                auto cost = std::lower_bound(costOrder.begin(), costOrder.end(), turn, [&](EdgeId id, const Turn &t) {
+                    return turnsWithCost[id] < t;
+                });
+                turnGraph.addEdge(turn.first, turn.second);
+                costOfTurn.push_back(cost != costOrder.end() && turnsWithCost[*cost] == turn ? *cost :
+                                     INVALID_VALUE<EdgeId>);
+            }
+        }
+    }
+    assert(std::none_of(turnsWithCost.begin(), turnsWithCost.end(), [&](const Turn &turn) {
+        return std::binary_search(restrictedTurns.begin(), restrictedTurns.end(), turn);
+    }) && "A restricted turn has a cost.");
+}
+
+OptimizedKit::Order OptimizedKit::CchTurnExpansion::expandOrder(const Order &inputOrder) const {
+    assert(inputOrder.size() == inputVertexCount());
+    auto rank = invertPermutation(inputOrder);
+    Order turnOrder(inputEdgeCount());
+    for (EdgeId edge = 0; edge < turnOrder.size(); ++edge)
+        turnOrder[edge] = edge;
+    auto key = [&](EdgeId edge) {
+        return std::minmax(rank[inputHead[edge]], rank[inputTail[edge]]);
+    };
+    std::stable_sort(turnOrder.begin(), turnOrder.end(), [&](EdgeId a, EdgeId b) {
+        auto [aLow, aHigh] = key(a);
+        auto [bLow, bHigh] = key(b);
+        return std::make_pair(aHigh, aLow) < std::make_pair(bHigh, bLow);
+    });
+    return turnOrder;
+}
+
+OptimizedKit::MemoryUsage OptimizedKit::CchTurnExpansion::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("inputTail", inputTail)
+         .add("inputHead", inputHead)
+         .add("outEdgeIndices", outEdgeIndices)
+         .add("outEdges", outEdges)
+         .add("inEdgeIndices", inEdgeIndices)
+         .add("inEdges", inEdges)
+         .add("turnGraph", turnGraph.memoryUsage())
+         .add("costOfTurn", costOfTurn);
+    return usage;
+}
@@ -0,0 +1,17 @@
+#include <customizable_contraction_hierarchy/cch_turn_expansion.hpp>
+
+template<typename WeightType>
+std::vector<WeightType> OptimizedKit::CchTurnExpansion::expandWeights(const std::vector<WeightType> &inputWeights,
+                                                                      const std::vector<WeightType> &turnCosts) const {
+    using Traits = WeightTraits<WeightType>;
+    assert(inputWeights.size() == inputEdgeCount());
+    assert(turnCosts.size() == turnCostCount && "Every turn with a cost needs its cost.");
+    std::vector<WeightType> turnWeights(turnCount());
+    for (EdgeId turn = 0; turn < turnCount(); ++turn) {
+        auto weight = inputWeights[turnGraph.head[turn]];
+        if (costOfTurn[turn] != INVALID_VALUE<EdgeId>)
+            weight = Traits::add(weight, turnCosts[costOfTurn[turn]]);
+        turnWeights[turn] = weight;
+    }
+    return turnWeights;
+}
@@ -0,0 +1,79 @@
+#include <customizable_contraction_hierarchy/cch_turn_query.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchTurnQuery<WeightType>::CchTurnQuery(const CchTurnExpansion &expansion,
+                                                     const CchCustomizer<WeightType> &turnCustomizer,
+                                                     const std::vector<WeightType> &inputWeights, HeapType heapType)
+        : CchTurnQuery(expansion, turnCustomizer, inputWeights.data(), heapType) {}
+
+template<typename WeightType>
+OptimizedKit::CchTurnQuery<WeightType>::CchTurnQuery(const CchTurnExpansion &expansion,
+                                                     const CchCustomizer<WeightType> &turnCustomizer,
+                                                     const WeightType *inputWeights, HeapType heapType)
+        : expansion(&expansion), inputWeights(inputWeights), turnQuery(turnCustomizer, heapType) {
+    assert(turnCustomizer.cchPreprocessor->cchVertexCount() == expansion.inputEdgeCount() &&
+           "The customizer is not built on the turn graph of the expansion.");
+}
+
+template<typename WeightType>
+OptimizedKit::CchTurnQuery<WeightType> &OptimizedKit::CchTurnQuery<WeightType>::run(VertexId source_, VertexId target_) {
+    assert(state == QueryState::INITIALIZED || state == QueryState::FINISHED);
+    assert(source_ < expansion->inputVertexCount() && "Source vertex id is out of bounds.");
+    assert(target_ < expansion->inputVertexCount() && "Target vertex id is out of bounds.");
+    const auto &e = *expansion;
+    source = source_;
+    target = target_;
+    sources.clear();
+    targets.clear();
+    state = QueryState::FINISHED;
+
+    // Staying at the source uses no edge and hence no turn.
+    if (source == target) {
+        queryWeight = WeightType{};
+        return *this;
+    }
+
+    queryWeight = INFINITY_WEIGHT<WeightType>;
+    for (auto i = e.outEdgeIndices[source]; i < e.outEdgeIndices[source + 1]; ++i)
+        if (!Traits::isInfinite(inputWeights[e.outEdges[i]]))
+            sources.emplace_back(e.outEdges[i], inputWeights[e.outEdges[i]]);
+    for (auto i = e.inEdgeIndices[target]; i < e.inEdgeIndices[target + 1]; ++i)
+        targets.emplace_back(e.inEdges[i], WeightType{});
+    if (sources.empty() || targets.empty())
+        return *this;
+    turnQuery.run(sources, targets);
+    queryWeight = turnQuery.getQueryWeight();
+    return *this;
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::CchTurnQuery<WeightType>::getQueryWeight() {
+    assert(state == QueryState::FINISHED);
+    return queryWeight;
+}
+
+template<typename WeightType>
+std::vector<OptimizedKit::EdgeId> OptimizedKit::CchTurnQuery<WeightType>::getEdgePath() {
+    assert(state == QueryState::FINISHED);
+    std::vector<EdgeId> path;
+    if (Traits::isInfinite(queryWeight) || source == target)
+        return path;
+
+    // Vertices of the turn graph are input edges, every turn adds the edge it turns into.
+    path.push_back(turnQuery.getSource());
+    for (auto turn: turnQuery.getEdgePath())
+        path.push_back(expansion->turnGraph.head[turn]);
+    return path;
+}
+
+template<typename WeightType>
+std::vector<OptimizedKit::VertexId> OptimizedKit::CchTurnQuery<WeightType>::getVertexPath() {
+    auto edgePath = getEdgePath();
+    std::vector<VertexId> vertexPath;
+    if (Traits::isInfinite(queryWeight))
+        return vertexPath;
+    vertexPath.push_back(source);
+    for (auto edge: edgePath)
+        vertexPath.push_back(expansion->inputHead[edge]);
+    return vertexPath;
+}
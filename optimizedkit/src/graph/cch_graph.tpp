@@ -4,6 +4,7 @@ template<typename WeightType>
 OptimizedKit::CchGraph<WeightType>::CchGraph(const CchPreprocessor *preprocessor,
                                              const CchCustomizer <WeightType> *customizer) {
     upwardsGraph = &preprocessor->upwardsGraph;
+    // The base metric, the pruned arcs of a perfect metric are left out by CchCustomizer::getQueryGraph.
     forwardWeights = &customizer->forwardWeights;
     backwardWeights = &customizer->backwardWeights;
     vertexCount = preprocessor->cchVertexCount();
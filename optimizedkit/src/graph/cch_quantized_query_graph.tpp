@@ -0,0 +1,44 @@
+#include <graph/cch_quantized_query_graph.hpp>
+
+template<typename WeightType>
+void OptimizedKit::QuantizedWeights<WeightType>::build(const WeightType *weights, const std::vector<VertexId> &groupOf,
+                                                      unsigned long groupCount) {
+    using Traits = WeightTraits<WeightType>;
+    auto edgeCount = groupOf.size();
+
+    // The base of a group is its smallest finite weight, groups without one are never decoded relative to it.
+    base.assign(groupCount, INFINITY_WEIGHT<WeightType>);
+    for (EdgeId edge = 0; edge < edgeCount; ++edge)
+        if (!Traits::isInfinite(weights[edge]))
+            base[groupOf[edge]] = Traits::min(base[groupOf[edge]], weights[edge]);
+
+    offsets.resize(edgeCount);
+    outliers.clear();
+    for (EdgeId edge = 0; edge < edgeCount; ++edge) {
+        if (Traits::isInfinite(weights[edge])) {
+            offsets[edge] = INFINITE_OFFSET;
+            continue;
+        }
+        auto offset = weights[edge] - base[groupOf[edge]];
+        if (offset < ESCAPED_OFFSET) {
+            offsets[edge] = static_cast<std::uint16_t>(offset);
+        } else {
+            offsets[edge] = ESCAPED_OFFSET;
+            outliers.emplace_back(edge, weights[edge]);
+        }
+    }
+    outliers.shrink_to_fit();
+}
+
+template<typename WeightType>
+WeightType OptimizedKit::QuantizedWeights<WeightType>::operator()(EdgeId edge, VertexId group) const {
+    auto offset = offsets[edge];
+    if (offset < ESCAPED_OFFSET)
+        return static_cast<WeightType>(base[group] + offset);
+    if (offset == INFINITE_OFFSET)
+        return INFINITY_WEIGHT<WeightType>;
+    auto outlier = std::lower_bound(outliers.begin(), outliers.end(), edge,
+                                    [](const auto &entry, EdgeId value) { return entry.first < value; });
+    assert(outlier != outliers.end() && outlier->first == edge);
+    return outlier->second;
+}
@@ -0,0 +1,89 @@
+#include <graph/cch_query_graph.hpp>
+
+template<typename WeightType>
+OptimizedKit::CchQueryGraph<WeightType>::CchQueryGraph(const CchGraph<WeightType> &graph) {
+    build(graph);
+}
+
+template<typename WeightType>
+OptimizedKit::CchQueryGraph<WeightType> &OptimizedKit::CchQueryGraph<WeightType>::build(const CchGraph<WeightType> &graph) {
+    return pack(*graph.upwardsGraph, graph.vertexCount, [&](EdgeId edge) {
+        return std::make_pair((*graph.forwardWeights)[edge], (*graph.backwardWeights)[edge]);
+    }, true);
+}
+
+template<typename WeightType>
+template<class ArcWeights>
+OptimizedKit::CchQueryGraph<WeightType> &
+OptimizedKit::CchQueryGraph<WeightType>::buildCompacted(const Graph &upwardsGraph, unsigned long vertexCount_,
+                                                        const ArcWeights &arcWeights) {
+    return pack(upwardsGraph, vertexCount_, arcWeights, false);
+}
+
+template<typename WeightType>
+template<class ArcWeights>
+OptimizedKit::CchQueryGraph<WeightType> &
+OptimizedKit::CchQueryGraph<WeightType>::pack(const Graph &upwardsGraph, unsigned long vertexCount_,
+                                              const ArcWeights &arcWeights, bool keepInfiniteArcs) {
+    // Number of arcs per cache line, blocks start at multiples of it.
+    constexpr EdgeId arcAlignment = CACHE_LINE_SIZE / sizeof(CchQueryArc<WeightType>);
+    const auto &adjacencyIndices = upwardsGraph.adjacencyIndices;
+    VertexId adjacencyVertexCount = adjacencyIndices.empty() ? 0 : adjacencyIndices.size() - 1;
+    vertexCount = vertexCount_;
+    auto isKept = [&](const std::pair<WeightType, WeightType> &weights) {
+        return keepInfiniteArcs || weights.first != INFINITY_WEIGHT<WeightType> ||
+               weights.second != INFINITY_WEIGHT<WeightType>;
+    };
+
+    // Compute the padded arc blocks, vertices without arcs get empty ranges.
+    arcRanges.assign(vertexCount, CchQueryArcRange{0, 0});
+    EdgeId nextArc = 0;
+    for (VertexId x = 0; x < std::min<unsigned long>(vertexCount, adjacencyVertexCount); ++x) {
+        EdgeId degree = adjacencyIndices[x + 1] - adjacencyIndices[x];
+        if (!keepInfiniteArcs) {
+            degree = 0;
+            for (EdgeId edge = adjacencyIndices[x]; edge < adjacencyIndices[x + 1]; ++edge)
+                degree += isKept(arcWeights(edge));
+        }
+        if (degree == 0)
+            continue;
+        arcRanges[x] = {nextArc, nextArc + degree};
+        nextArc = (nextArc + degree + arcAlignment - 1) / arcAlignment * arcAlignment;
+    }
+
+    // Pack head and both weights of every arc in one pass, padding arcs are never read.
+    arcs.assign(nextArc, CchQueryArc<WeightType>{INVALID_VALUE<VertexId>, INFINITY_WEIGHT<WeightType>,
+                                                 INFINITY_WEIGHT<WeightType>, INVALID_VALUE<EdgeId>});
+    for (VertexId x = 0; x < std::min<unsigned long>(vertexCount, adjacencyVertexCount); ++x) {
+        auto arc = arcRanges[x].begin;
+        for (EdgeId edge = adjacencyIndices[x]; edge < adjacencyIndices[x + 1]; ++edge) {
+            auto weights = arcWeights(edge);
+            if (isKept(weights))
+                arcs[arc++] = {upwardsGraph.head[edge], weights.first, weights.second, edge};
+        }
+    }
+    return *this;
+}
+
+template<typename WeightType>
+const OptimizedKit::CchQueryArc<WeightType> *OptimizedKit::CchQueryGraph<WeightType>::findArc(VertexId x, VertexId y) const {
+    const auto &range = arcRanges[x];
+    auto arc = std::find_if(arcs.begin() + range.begin, arcs.begin() + range.end,
+                            [&](const CchQueryArc<WeightType> &candidate) { return candidate.head == y; });
+    return arc == arcs.begin() + range.end ? nullptr : &*arc;
+}
+
+template<typename WeightType>
+OptimizedKit::EdgeId OptimizedKit::CchQueryGraph<WeightType>::arcCount() const {
+    EdgeId count = 0;
+    for (const auto &range: arcRanges)
+        count += range.end - range.begin;
+    return count;
+}
+
+template<typename WeightType>
+OptimizedKit::CchQueryGraph<WeightType> &OptimizedKit::CchQueryGraph<WeightType>::setHugePagePolicy(HugePagePolicy policy) {
+    if (arcs.get_allocator().getPolicy() != policy)
+        arcs = decltype(arcs)(arcs.begin(), arcs.end(), HugePageAllocator<CchQueryArc<WeightType>, CACHE_LINE_SIZE>(policy));
+    return *this;
+}
@@ -0,0 +1,60 @@
+#include <algorithm>
+#include <limits>
+#include <graph/compressed_graph.hpp>
+
+OptimizedKit::CompressedGraph::CompressedGraph(const OptimizedKit::Graph &graph)
+        : adjacencyIndices(graph.adjacencyIndices), vertexCount(graph.vertexCount) {
+    assert(adjacencyIndices.size() == vertexCount + 1 && "Graph requires adjacency indices.");
+    byteOffsets.resize(vertexCount);
+    bytes.reserve(graph.getEdgeCount() + vertexCount);
+    for (VertexId x = 0; x < vertexCount; ++x) {
+        byteOffsets[x] = static_cast<std::uint32_t>(bytes.size());
+        VertexId previous = x;
+        for (EdgeId edge = adjacencyIndices[x]; edge < adjacencyIndices[x + 1]; ++edge) {
+            assert(graph.tail[edge] == x && "Graph edges must be sorted by tail.");
+            VertexId head = graph.head[edge];
+            if (edge == adjacencyIndices[x]) {
+                // Zigzag encode the signed difference to the tail, heads of downwards graphs lie below it.
+                auto difference = static_cast<std::make_signed_t<VertexId>>(head - x);
+                encodeVarint((static_cast<VertexId>(difference) << 1) ^
+                             static_cast<VertexId>(difference >> (8 * sizeof(VertexId) - 1)));
+            } else {
+                assert(previous <= head && "Heads must be sorted within each adjacency range.");
+                encodeVarint(head - previous);
+            }
+            previous = head;
+        }
+    }
+    assert(bytes.size() <= std::numeric_limits<std::uint32_t>::max() && "Byte offsets must fit 32 bits.");
+    bytes.shrink_to_fit();
+}
+
+void OptimizedKit::CompressedGraph::encodeVarint(VertexId value) {
+    while (value >= 0x80) {
+        bytes.push_back(static_cast<std::uint8_t>(value | 0x80));
+        value >>= 7;
+    }
+    bytes.push_back(static_cast<std::uint8_t>(value));
+}
+
+OptimizedKit::VertexId OptimizedKit::CompressedGraph::tailOf(EdgeId edge) const {
+    assert(edge < getEdgeCount());
+    return std::upper_bound(adjacencyIndices.begin(), adjacencyIndices.end(), edge) - adjacencyIndices.begin() - 1;
+}
+
+OptimizedKit::VertexId OptimizedKit::CompressedGraph::headOf(EdgeId edge) const {
+    auto range = adjacency(tailOf(edge));
+    auto it = range.begin();
+    while (it.edge() != edge)
+        ++it;
+    return *it;
+}
+
+OptimizedKit::MemoryUsage OptimizedKit::CompressedGraph::memoryUsage() const {
+    return MemoryUsage().add("adjacencyIndices", adjacencyIndices).add("byteOffsets", byteOffsets).add("bytes", bytes);
+}
+
+std::size_t OptimizedKit::CompressedGraph::adviseHugePages(HugePagePolicy policy) const {
+    return OptimizedKit::adviseHugePages(adjacencyIndices, policy) + OptimizedKit::adviseHugePages(byteOffsets, policy) +
+           OptimizedKit::adviseHugePages(bytes, policy);
+}
@@ -36,3 +36,11 @@ void OptimizedKit::Graph::removeEdges(const OptimizedKit::Filter &removeEdgeFilt
     createAdjacencyIndices();
 }
 
+OptimizedKit::MemoryUsage OptimizedKit::Graph::memoryUsage() const {
+    return MemoryUsage().add("tail", tail).add("head", head).add("adjacencyIndices", adjacencyIndices);
+}
+
+std::size_t OptimizedKit::Graph::adviseHugePages(HugePagePolicy policy) const {
+    return OptimizedKit::adviseHugePages(tail, policy) + OptimizedKit::adviseHugePages(head, policy) +
+           OptimizedKit::adviseHugePages(adjacencyIndices, policy);
+}
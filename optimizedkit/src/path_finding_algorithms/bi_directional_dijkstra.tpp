@@ -3,42 +3,104 @@
 template<typename WeightType>
 void
 OptimizedKit::BiDirectionalDijkstra<WeightType>::initialize() {
-    assert(source < vertexCount && "Source is not set");
-    assert(target < vertexCount && "Target is not set");
-
     meetingVertex = INVALID_VALUE<VertexId>;
     shortestPathLength = INFINITY_WEIGHT<WeightType>;
 
-    forwardDistance.clear();
-    forwardDistance.resize(vertexCount, INFINITY_WEIGHT<WeightType>);
-    forwardDistance[source] = 0;
-    backwardDistance.clear();
-    backwardDistance.resize(vertexCount, INFINITY_WEIGHT<WeightType>);
-    backwardDistance[target] = 0;
-
     forwardQueue->clear();
-    forwardQueue->insertOrUpdate(0, source);
     backwardQueue->clear();
-    backwardQueue->insertOrUpdate(0, target);
 
-    forwardPredecessor.clear();
-    forwardPredecessor.resize(vertexCount, INVALID_VALUE<VertexId>);
-    backwardPredecessor.clear();
-    backwardPredecessor.resize(vertexCount, INVALID_VALUE<VertexId>);
+    // Predecessors are only tracked if paths are requested or ties are broken, distance only queries release them.
+    bool isPathMode = tracksPredecessors();
+    if (!isPathMode && forwardPredecessor.capacity() != 0) {
+        forwardPredecessor.clear();
+        forwardPredecessor.shrink_to_fit();
+        backwardPredecessor.clear();
+        backwardPredecessor.shrink_to_fit();
+    }
+
+    // Arrays sized by an earlier search only differ from their initial state at the vertices it reached.
+    if (forwardDistance.size() == vertexCount && (!isPathMode || forwardPredecessor.size() == vertexCount)) {
+        for (auto x: touchedVertices) {
+            forwardDistance[x] = INFINITY_WEIGHT<WeightType>;
+            backwardDistance[x] = INFINITY_WEIGHT<WeightType>;
+            forwardSettled[x] = false;
+            backwardSettled[x] = false;
+            if (isPathMode) {
+                forwardPredecessor[x] = INVALID_VALUE<VertexId>;
+                backwardPredecessor[x] = INVALID_VALUE<VertexId>;
+            }
+        }
+    } else {
+        forwardDistance.assign(vertexCount, INFINITY_WEIGHT<WeightType>);
+        backwardDistance.assign(vertexCount, INFINITY_WEIGHT<WeightType>);
+        if (isPathMode) {
+            forwardPredecessor.assign(vertexCount, INVALID_VALUE<VertexId>);
+            backwardPredecessor.assign(vertexCount, INVALID_VALUE<VertexId>);
+        }
+        forwardSettled.assign(vertexCount, false);
+        backwardSettled.assign(vertexCount, false);
+    }
+    touchedVertices.clear();
+
+    // Totals are written whenever a vertex is reached, hence only their size has to match.
+    forwardAttributeTotals.resize(vertexCount * attributeCount);
+    backwardAttributeTotals.resize(vertexCount * attributeCount);
+    if (attributeCount == 0 && forwardAttributeTotals.capacity() != 0) {
+        forwardAttributeTotals.shrink_to_fit();
+        backwardAttributeTotals.shrink_to_fit();
+    }
+}
+
+template<typename WeightType>
+OptimizedKit::BiDirectionalDijkstra<WeightType> &
+OptimizedKit::BiDirectionalDijkstra<WeightType>::setArcAttributes(unsigned count, const WeightType *forwardAttributes,
+                                                                   const WeightType *backwardAttributes) {
+    attributeCount = count;
+    forwardArcAttributes = count != 0 ? forwardAttributes : nullptr;
+    backwardArcAttributes = count != 0 ? backwardAttributes : nullptr;
+    return *this;
+}
+
+template<typename WeightType>
+bool OptimizedKit::BiDirectionalDijkstra<WeightType>::relaxAttributeTotals(bool forward, VertexId u, VertexId x,
+                                                                           EdgeId cchEdge, bool isShorter) {
+    auto &totals = forward ? forwardAttributeTotals : backwardAttributeTotals;
+    const auto *arcAttributes = (forward ? forwardArcAttributes : backwardArcAttributes) +
+                                static_cast<std::size_t>(cchEdge) * attributeCount;
+    const auto *uTotals = &totals[static_cast<std::size_t>(u) * attributeCount];
+    auto *xTotals = &totals[static_cast<std::size_t>(x) * attributeCount];
+
+    // An equally short path only replaces the totals of x if they are lexicographically smaller.
+    if (!isShorter) {
+        unsigned k = 0;
+        while (k < attributeCount && Traits::add(uTotals[k], arcAttributes[k]) == xTotals[k])
+            ++k;
+        if (k == attributeCount || xTotals[k] < Traits::add(uTotals[k], arcAttributes[k]))
+            return false;
+    }
+    for (unsigned k = 0; k < attributeCount; ++k)
+        xTotals[k] = Traits::add(uTotals[k], arcAttributes[k]);
+    return true;
+}
 
-    forwardSettled.clear();
-    forwardSettled.resize(vertexCount, false);
-    backwardSettled.clear();
-    backwardSettled.resize(vertexCount, false);
+template<typename WeightType>
+bool OptimizedKit::BiDirectionalDijkstra<WeightType>::hasSmallerMeetingTotals(VertexId x) const {
+    if (meetingVertex == INVALID_VALUE<VertexId> || meetingVertex == x || Traits::isInfinite(shortestPathLength))
+        return false;
+    auto xOffset = static_cast<std::size_t>(x) * attributeCount;
+    auto meetingOffset = static_cast<std::size_t>(meetingVertex) * attributeCount;
+    for (unsigned k = 0; k < attributeCount; ++k) {
+        auto xTotal = Traits::add(forwardAttributeTotals[xOffset + k], backwardAttributeTotals[xOffset + k]);
+        auto meetingTotal = Traits::add(forwardAttributeTotals[meetingOffset + k], backwardAttributeTotals[meetingOffset + k]);
+        if (xTotal != meetingTotal)
+            return xTotal < meetingTotal;
+    }
+    return false;
 }
 
 template<typename WeightType>
 OptimizedKit::BiDirectionalDijkstra<WeightType> &OptimizedKit::BiDirectionalDijkstra<WeightType>::run(VertexId sourceId, VertexId targetId, bool debug) {
-    source = sourceId;
-    target = targetId;
-    initialize();
-    bool forwardSearchActive = true;
-    bool backwardSearchActive = true;
+    start(sourceId, targetId);
 
     if(debug){
         std::cout << "Running search space analysis for source " << source << " and target " << target << std::endl;
@@ -46,92 +108,214 @@ OptimizedKit::BiDirectionalDijkstra<WeightType> &OptimizedKit::BiDirectionalDijk
         numVerticesExplored = 0;
     }
 
-    while (forwardSearchActive || backwardSearchActive) {
-        // Forward search.
-        if(forwardSearchActive){
-            auto u = forwardQueue->deleteMin();
-            forwardSettled[u] = true;
-            if(debug)
-                numVerticesExplored++;
-
-            // Check if forward search has reached backward search with a shorter path.
-            if (backwardSettled[u] && shortestPathLength > forwardDistance[u] + backwardDistance[u]) {
-                shortestPathLength = forwardDistance[u] + backwardDistance[u];
-                meetingVertex = u;
-                if (debug)
-                    std::cout << "New shorter path in forward search between source " << source << " via meeting point "
-                              << meetingVertex << " and target " << target << " with length: " << shortestPathLength
-                              << std::endl;
-            }
+    while (step(debug));
+
+    if(debug){
+        std::cout << "Search space analysis for source " << source << " and target " << target << std::endl;
+        std::cout << "Number of vertices explored: " << numVerticesExplored << std::endl;
+        std::cout << "Number of edges explored: " << numEdgesExplored << std::endl;
+    }
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::BiDirectionalDijkstra<WeightType> &OptimizedKit::BiDirectionalDijkstra<WeightType>::start(VertexId sourceId, VertexId targetId) {
+    source = sourceId;
+    target = targetId;
+    assert(source < vertexCount && "Source is not set");
+    assert(target < vertexCount && "Target is not set");
+    initialize();
+    forwardDistance[source] = 0;
+    forwardQueue->insertOrUpdate(0, source);
+    std::fill_n(forwardAttributeTotals.begin() + static_cast<std::size_t>(source) * attributeCount, attributeCount, WeightType{});
+    backwardDistance[target] = 0;
+    std::fill_n(backwardAttributeTotals.begin() + static_cast<std::size_t>(target) * attributeCount, attributeCount, WeightType{});
+    backwardQueue->insertOrUpdate(0, target);
+    touchedVertices.push_back(source);
+    touchedVertices.push_back(target);
+    forwardSearchActive = true;
+    backwardSearchActive = true;
+    return *this;
+}
+
+template<typename WeightType>
+OptimizedKit::BiDirectionalDijkstra<WeightType> &OptimizedKit::BiDirectionalDijkstra<WeightType>::start(
+        const std::vector<std::pair<VertexId, WeightType>> &sources,
+        const std::vector<std::pair<VertexId, WeightType>> &targets) {
+    source = INVALID_VALUE<VertexId>;
+    target = INVALID_VALUE<VertexId>;
+    initialize();
+
+    // Seed both searches with all endpoints at their initial distance, duplicates keep the smallest one.
+    for (const auto &[sourceId, offset]: sources) {
+        assert(sourceId < vertexCount && "Source vertex id is out of bounds.");
+        if (offset < forwardDistance[sourceId]) {
+            forwardDistance[sourceId] = offset;
+            std::fill_n(forwardAttributeTotals.begin() + static_cast<std::size_t>(sourceId) * attributeCount,
+                        attributeCount, WeightType{});
+            touchedVertices.push_back(sourceId);
+            forwardQueue->insertOrUpdate(offset, sourceId);
+        }
+    }
+    for (const auto &[targetId, offset]: targets) {
+        assert(targetId < vertexCount && "Target vertex id is out of bounds.");
+        if (offset < backwardDistance[targetId]) {
+            backwardDistance[targetId] = offset;
+            std::fill_n(backwardAttributeTotals.begin() + static_cast<std::size_t>(targetId) * attributeCount,
+                        attributeCount, WeightType{});
+            touchedVertices.push_back(targetId);
+            backwardQueue->insertOrUpdate(offset, targetId);
+        }
+    }
+    forwardSearchActive = !forwardQueue->isEmpty() && !backwardQueue->isEmpty();
+    backwardSearchActive = forwardSearchActive;
+    return *this;
+}
+
+template<typename WeightType>
+bool OptimizedKit::BiDirectionalDijkstra<WeightType>::step(bool debug) {
+    if (!forwardSearchActive && !backwardSearchActive)
+        return false;
 
-            // Relax all outgoing edges of (u,x) with weight in forward search.
-            for (auto forwardArc = cchGraph.upwardsGraph->adjacencyIndices[u];
-                 forwardArc < cchGraph.upwardsGraph->adjacencyIndices[u+1]; ++forwardArc) {
-                auto x = cchGraph.upwardsGraph->head[forwardArc];
+    // A quantized metric is searched on its view, decoding the weights of every relaxed arc.
+    return quantizedQueryGraph ? stepOn(*quantizedQueryGraph, debug) : stepOn(*queryGraph, debug);
+}
+
+template<typename WeightType>
+template<class QueryGraph>
+bool OptimizedKit::BiDirectionalDijkstra<WeightType>::stepOn(const QueryGraph &graph, bool debug) {
+    // Forward search.
+    if(forwardSearchActive){
+        auto u = forwardQueue->deleteMin();
+        forwardSettled[u] = true;
+        if(debug)
+            numVerticesExplored++;
 
-                if (forwardSettled[x])
-                    continue;
+        // Check if forward search has reached backward search with a shorter path, or an equally short one with smaller totals.
+        auto length = Traits::add(forwardDistance[u], backwardDistance[u]);
+        if (backwardSettled[u] && (shortestPathLength > length ||
+                                  (attributeCount != 0 && shortestPathLength == length && hasSmallerMeetingTotals(u)))) {
+            shortestPathLength = Traits::add(forwardDistance[u], backwardDistance[u]);
+            meetingVertex = u;
+            if (debug)
+                std::cout << "New shorter path in forward search between source " << source << " via meeting point "
+                          << meetingVertex << " and target " << target << " with length: " << shortestPathLength
+                          << std::endl;
+        }
+
+        // Relax all outgoing edges of (u,x) with weight in forward search.
+        const auto &forwardArcs = graph.arcsOf(u);
+        for (auto forwardArc = forwardArcs.begin; forwardArc < forwardArcs.end; ++forwardArc) {
+            const auto &arc = graph.arcAt(u, forwardArc);
+            auto x = arc.head;
 
-                if(debug)
-                    numEdgesExplored++;
+            if (forwardSettled[x] && attributeCount == 0)
+                continue;
 
-                auto weight = cchGraph.forwardWeights->at(forwardArc);
-                if (forwardDistance[x] > forwardDistance[u] + weight) {
-                    forwardDistance[x] = forwardDistance[u] + weight;
+            if(debug)
+                numEdgesExplored++;
+
+            auto distance = Traits::add(forwardDistance[u], arc.forwardWeight);
+            if (forwardDistance[x] > distance) {
+                if (Traits::isInfinite(forwardDistance[x]))
+                    touchedVertices.push_back(x);
+                forwardDistance[x] = distance;
+                if (tracksPredecessors())
                     forwardPredecessor[x] = u;
-                    forwardQueue->insertOrUpdate(forwardDistance[x], x);
+                if (attributeCount != 0)
+                    relaxAttributeTotals(true, u, x, arc.cchEdge, true);
+                forwardQueue->insertOrUpdate(forwardDistance[x], x);
+            } else if (attributeCount != 0 && forwardDistance[x] == distance && !Traits::isInfinite(distance) &&
+                       relaxAttributeTotals(true, u, x, arc.cchEdge, false)) {
+                // A settled vertex passes its smaller totals on to its successors once more.
+                forwardPredecessor[x] = u;
+                if (forwardSettled[x]) {
+                    forwardSettled[x] = false;
+                    forwardQueue->insertOrUpdate(distance, x);
                 }
             }
         }
+    }
 
-        // Backward search.
-        if(backwardSearchActive){
-            auto v = backwardQueue->deleteMin();
-            backwardSettled[v] = true;
+    // Backward search.
+    if(backwardSearchActive){
+        auto v = backwardQueue->deleteMin();
+        backwardSettled[v] = true;
 
-            if(debug)
-                numVerticesExplored++;
-
-            // Check if backward search has reached forward search with a shorter path.
-            if (forwardSettled[v] && shortestPathLength > forwardDistance[v] + backwardDistance[v]) {
-                shortestPathLength = forwardDistance[v] + backwardDistance[v];
-                meetingVertex = v;
-                if (debug)
-                    std::cout << "New shorter path in backward search between source " << source << " via meeting point "
-                              << meetingVertex << " and target " << target << " with length: " << shortestPathLength
-                              << std::endl;
-            }
+        if(debug)
+            numVerticesExplored++;
+
+        // Check if backward search has reached forward search with a shorter path, or an equally short one with smaller totals.
+        auto length = Traits::add(forwardDistance[v], backwardDistance[v]);
+        if (forwardSettled[v] && (shortestPathLength > length ||
+                                  (attributeCount != 0 && shortestPathLength == length && hasSmallerMeetingTotals(v)))) {
+            shortestPathLength = Traits::add(forwardDistance[v], backwardDistance[v]);
+            meetingVertex = v;
+            if (debug)
+                std::cout << "New shorter path in backward search between source " << source << " via meeting point "
+                          << meetingVertex << " and target " << target << " with length: " << shortestPathLength
+                          << std::endl;
+        }
 
-            // Relax all outgoing edges of (v,y) with weight in backward search.
-            for (auto backwardArc = cchGraph.upwardsGraph->adjacencyIndices[v];
-                 backwardArc < cchGraph.upwardsGraph->adjacencyIndices[v+1]; ++backwardArc) {
-                auto y = cchGraph.upwardsGraph->head[backwardArc];
+        // Relax all outgoing edges of (v,y) with weight in backward search.
+        const auto &backwardArcs = graph.arcsOf(v);
+        for (auto backwardArc = backwardArcs.begin; backwardArc < backwardArcs.end; ++backwardArc) {
+            const auto &arc = graph.arcAt(v, backwardArc);
+            auto y = arc.head;
 
-                if (backwardSettled[y])
-                    continue;
+            if (backwardSettled[y] && attributeCount == 0)
+                continue;
 
-                if(debug)
-                    numEdgesExplored++;
+            if(debug)
+                numEdgesExplored++;
 
-                auto weight = cchGraph.backwardWeights->at(backwardArc);
-                if (backwardDistance[y] > backwardDistance[v] + weight) {
-                    backwardDistance[y] = backwardDistance[v] + weight;
+            auto distance = Traits::add(backwardDistance[v], arc.backwardWeight);
+            if (backwardDistance[y] > distance) {
+                if (Traits::isInfinite(backwardDistance[y]))
+                    touchedVertices.push_back(y);
+                backwardDistance[y] = distance;
+                if (tracksPredecessors())
                     backwardPredecessor[y] = v;
-                    backwardQueue->insertOrUpdate(backwardDistance[y], y);
+                if (attributeCount != 0)
+                    relaxAttributeTotals(false, v, y, arc.cchEdge, true);
+                backwardQueue->insertOrUpdate(backwardDistance[y], y);
+            } else if (attributeCount != 0 && backwardDistance[y] == distance && !Traits::isInfinite(distance) &&
+                       relaxAttributeTotals(false, v, y, arc.cchEdge, false)) {
+                // A settled vertex passes its smaller totals on to its successors once more.
+                backwardPredecessor[y] = v;
+                if (backwardSettled[y]) {
+                    backwardSettled[y] = false;
+                    backwardQueue->insertOrUpdate(distance, y);
                 }
             }
         }
-
-        // Bi-directional termination criteria.
-        forwardSearchActive = !forwardQueue->isEmpty() && forwardQueue->peek() < shortestPathLength;
-        backwardSearchActive = !backwardQueue->isEmpty() && backwardQueue->peek() < shortestPathLength;
     }
 
-    if(debug){
-        std::cout << "Search space analysis for source " << source << " and target " << target << std::endl;
-        std::cout << "Number of vertices explored: " << numVerticesExplored << std::endl;
-        std::cout << "Number of edges explored: " << numEdgesExplored << std::endl;
-    }
-    return *this;
+    // Bi-directional termination criteria, breaking ties also settles the vertices as far as the shortest path.
+    auto isActive = [&](AbstractHeap<WeightType, VertexId> &queue) {
+        return !queue.isEmpty() && (queue.peek() < shortestPathLength ||
+                                    (attributeCount != 0 && queue.peek() == shortestPathLength));
+    };
+    forwardSearchActive = isActive(*forwardQueue);
+    backwardSearchActive = isActive(*backwardQueue);
+    return forwardSearchActive || backwardSearchActive;
 }
 
+template<typename WeightType>
+OptimizedKit::MemoryUsage OptimizedKit::BiDirectionalDijkstra<WeightType>::memoryUsage() const {
+    MemoryUsage usage;
+    usage.add("forwardDistance", forwardDistance)
+         .add("backwardDistance", backwardDistance)
+         .add("forwardPredecessor", forwardPredecessor)
+         .add("backwardPredecessor", backwardPredecessor)
+         .add("forwardSettled", forwardSettled)
+         .add("backwardSettled", backwardSettled)
+         .add("forwardAttributeTotals", forwardAttributeTotals)
+         .add("backwardAttributeTotals", backwardAttributeTotals)
+         .add("touchedVertices", touchedVertices);
+    if (forwardQueue)
+        usage.add("forwardQueue", forwardQueue->memoryUsage());
+    if (backwardQueue)
+        usage.add("backwardQueue", backwardQueue->memoryUsage());
+    return usage;
+}
@@ -16,10 +16,10 @@ OptimizedKit::Dijkstra<WeightType> &OptimizedKit::Dijkstra<WeightType>::initiali
     // Compute all distances from source in graph.
     while(!queue.isEmpty()){
         auto u = queue.deleteMin().id;
-        for (auto neighbour = cchGraph.upwardsGraph->adjacencyIndices->at(u);
-             neighbour < cchGraph.upwardsGraph->adjacencyIndices->at(u + 1); ++neighbour) {
-            auto v = cchGraph.upwardsGraph->head[neighbour];
-            auto weight = std::min(cchGraph.forwardWeights->at(neighbour), cchGraph.backwardWeights->at(neighbour)); // TODO: this is were this falls apart as one has to do a dijkstra from source to meeting point with forward weights and one dijkstra from target to meeting point and then you basically have a bi-directional dijkstra again.
+        const auto &arcs = queryGraph.arcsOf(u);
+        for (auto neighbour = arcs.begin; neighbour < arcs.end; ++neighbour) {
+            auto v = queryGraph.arcs[neighbour].head;
+            auto weight = std::min(queryGraph.arcs[neighbour].forwardWeight, queryGraph.arcs[neighbour].backwardWeight); // TODO: this is were this falls apart as one has to do a dijkstra from source to meeting point with forward weights and one dijkstra from target to meeting point and then you basically have a bi-directional dijkstra again.
             if(distances[v] > distances[u] + weight){
                 distances[v] = distances[u] + weight;
                 predecessors[v] = u;
@@ -48,9 +48,10 @@ std::vector<OptimizedKit::EdgeId> OptimizedKit::Dijkstra<WeightType>::getEdgePat
     for(auto i = 1; i < vertexPath.size(); ++i){
         auto u = vertexPath[i-1];
         auto v = vertexPath[i];
-        for(auto j = 0; j < cchGraph.upwardsGraph->tail.size(); j++){
-            if(cchGraph.upwardsGraph->tail[j] == u && cchGraph.upwardsGraph->head[j] == v){
-                arcPath.push_back(j);
+        const auto &arcs = queryGraph.arcsOf(u);
+        for(auto j = arcs.begin; j < arcs.end; j++){
+            if(queryGraph.arcs[j].head == v){
+                arcPath.push_back(queryGraph.arcs[j].cchEdge);
                 break;
             }
         }
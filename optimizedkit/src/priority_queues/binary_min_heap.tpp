@@ -2,11 +2,15 @@
 
 template<typename KeyType, typename IdType>
 int OptimizedKit::BinaryMinHeap<KeyType, IdType>::getIndex(const IdType &id) const {
-    try {
-        return indices.at(id);
-    } catch (std::out_of_range &e) {
-        return -1;
-    }
+    static_assert(std::is_unsigned_v<IdType>, "Ids index the position array.");
+    return id < indices.size() && indices[id] != INVALID_INDEX ? static_cast<int>(indices[id]) : -1;
+}
+
+template<typename KeyType, typename IdType>
+void OptimizedKit::BinaryMinHeap<KeyType, IdType>::setIndex(const IdType &id, unsigned index) {
+    if (id >= indices.size())
+        indices.resize(static_cast<std::size_t>(id) + 1, INVALID_INDEX);
+    indices[id] = index;
 }
 
 template<typename KeyType, typename IdType>
@@ -28,8 +32,8 @@ template<typename KeyType, typename IdType>
 void OptimizedKit::BinaryMinHeap<KeyType, IdType>::siftUp(unsigned int index) {
     while (index != 0 && getParentIndex(index) < heap.size() && heap[getParentIndex(index)].key > heap[index].key) {
         std::swap(heap[index], heap[getParentIndex(index)]);
-        indices[heap[index].id] = index;
-        indices[heap[getParentIndex(index)].id] = getParentIndex(index);
+        setIndex(heap[index].id, index);
+        setIndex(heap[getParentIndex(index)].id, getParentIndex(index));
         index = getParentIndex(index);
     }
 }
@@ -43,16 +47,19 @@ void OptimizedKit::BinaryMinHeap<KeyType, IdType>::siftDown(unsigned int index)
     if (rightChildIndex < heap.size() && heap[rightChildIndex].key < heap[smallest].key) smallest = rightChildIndex;
     if (smallest != index) {
         std::swap(heap[index], heap[smallest]);
-        indices[heap[index].id] = index;
-        indices[heap[smallest].id] = smallest;
+        setIndex(heap[index].id, index);
+        setIndex(heap[smallest].id, smallest);
         siftDown(smallest);
     }
 }
 
 template<typename KeyType, typename IdType>
 void OptimizedKit::BinaryMinHeap<KeyType, IdType>::insertOrUpdate(const KeyType &key) {
-    static_assert(std::is_same<KeyType, IdType>::value, "KeyType and IdType must be the same type");
-    this->insertOrUpdate(key, key);
+    // The overload is virtual and hence instantiated for every heap, it is only usable if keys are ids.
+    if constexpr (std::is_same_v<KeyType, IdType>)
+        this->insertOrUpdate(key, key);
+    else
+        throw std::logic_error("KeyType and IdType must be the same type");
 }
 
 template<typename KeyType, typename IdType>
@@ -62,7 +69,7 @@ void OptimizedKit::BinaryMinHeap<KeyType, IdType>::insertOrUpdate(const KeyType
         return;
     }
     heap.push_back(BinaryMinHeap::Node{key, id});
-    indices[id] = heap.size() - 1;
+    setIndex(id, heap.size() - 1);
     siftUp(heap.size() - 1);
 }
 
@@ -71,9 +78,9 @@ IdType OptimizedKit::BinaryMinHeap<KeyType, IdType>::deleteMin() {
     if (heap.empty()) throw std::out_of_range("The heap is empty.");
     Node min = heap[0];
     heap[0] = heap[heap.size() - 1];
-    indices[heap[0].id] = 0;
+    setIndex(heap[0].id, 0);
     heap.pop_back();
-    indices.erase(min.id);
+    indices[min.id] = INVALID_INDEX;
     siftDown(0);
     return min.id;
 }
@@ -114,11 +121,12 @@ std::string OptimizedKit::BinaryMinHeap<KeyType, IdType>::printOut() const {
 
 template<typename KeyType, typename IdType>
 bool OptimizedKit::BinaryMinHeap<KeyType, IdType>::isEmpty() const {
-    return heap.empty() && indices.empty();
+    return heap.empty();
 }
 
 template<typename KeyType, typename IdType>
 void OptimizedKit::BinaryMinHeap<KeyType, IdType>::clear() {
+    for (const auto &node: heap)
+        indices[node.id] = INVALID_INDEX;
     heap.clear();
-    indices.clear();
 }
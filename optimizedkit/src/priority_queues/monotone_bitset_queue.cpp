@@ -0,0 +1,54 @@
+#include <bit>
+#include <algorithm>
+#include <priority_queues/monotone_bitset_queue.hpp>
+
+OptimizedKit::MonotoneBitsetQueue::MonotoneBitsetQueue(EdgeId capacity) {
+    resize(capacity);
+}
+
+void OptimizedKit::MonotoneBitsetQueue::resize(EdgeId capacity) {
+    idCapacity = capacity;
+    words.assign((capacity + 63) / 64, 0);
+    count = 0;
+    firstWord = 0;
+    lastWord = 0;
+}
+
+bool OptimizedKit::MonotoneBitsetQueue::insert(EdgeId id) {
+    assert(id < idCapacity && "Id exceeds capacity of the queue.");
+    EdgeId word = id / 64;
+    uint64_t bit = uint64_t{1} << (id % 64);
+    if (words[word] & bit)
+        return false;
+    words[word] |= bit;
+
+    // Track the touched word range to bound the scan of deleteMin.
+    if (count == 0) {
+        firstWord = word;
+        lastWord = word;
+    } else {
+        firstWord = std::min(firstWord, word);
+        lastWord = std::max(lastWord, word);
+    }
+    ++count;
+    return true;
+}
+
+OptimizedKit::EdgeId OptimizedKit::MonotoneBitsetQueue::deleteMin() {
+    assert(count != 0 && "Queue is empty.");
+    while (words[firstWord] == 0)
+        ++firstWord;
+    assert(firstWord <= lastWord);
+    EdgeId id = firstWord * 64 + std::countr_zero(words[firstWord]);
+    words[firstWord] &= words[firstWord] - 1;
+    --count;
+    return id;
+}
+
+void OptimizedKit::MonotoneBitsetQueue::clear() {
+    if (count != 0)
+        std::fill(words.begin() + firstWord, words.begin() + lastWord + 1, 0);
+    count = 0;
+    firstWord = 0;
+    lastWord = 0;
+}
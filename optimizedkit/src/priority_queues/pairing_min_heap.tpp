@@ -104,13 +104,17 @@ IdType OptimizedKit::PairingMinHeap<KeyType, IdType>::deleteMin() {
 
 template<typename KeyType, typename IdType>
 void OptimizedKit::PairingMinHeap<KeyType, IdType>::insertOrUpdate(const KeyType &key) {
-    static_assert(std::is_same<KeyType, IdType>::value, "KeyType and IdType must be the same type");
-    auto it = indices.find(key);
-    if (it != indices.end())
-        return;
-    Node *node = new Node(key, key);
-    this->root = meld(this->root, node);
-    indices[key] = node;
+    // The overload is virtual and hence instantiated for every heap, it is only usable if keys are ids.
+    if constexpr (std::is_same_v<KeyType, IdType>) {
+        auto it = indices.find(key);
+        if (it != indices.end())
+            return;
+        Node *node = new Node(key, key);
+        this->root = meld(this->root, node);
+        indices[key] = node;
+    } else {
+        throw std::logic_error("KeyType and IdType must be the same type");
+    }
 }
 
 template<typename KeyType, typename IdType>
@@ -1,7 +1,9 @@
+#include <algorithm>
 #include "utils/graph_helper.hpp"
+#include "utils/constants.hpp"
 
 OptimizedKit::EdgeId
-OptimizedKit::findEdge(const std::vector<VertexId> &adjacencyList, const std::vector<VertexId> &head,
+OptimizedKit::findEdge(const std::vector<EdgeId> &adjacencyList, const std::vector<VertexId> &head,
                        VertexId x, VertexId y) {
     assert(x < adjacencyList.size()-2);
     assert(y < adjacencyList.size()-1);
@@ -29,11 +31,137 @@ std::vector<OptimizedKit::VertexId> OptimizedKit::convertEdgePathToVertexPath(co
 std::vector<OptimizedKit::EdgeId> OptimizedKit::convertVertexPathToEdgePath(const std::vector<VertexId> &tail,
                                                                             const std::vector<VertexId> &head,
                                                                             std::vector<VertexId> &vertexPath) {
-    assert(isVectorSorted(head));
+    assert(isVectorSorted(tail));
+    auto adjacencyIndices = constructAdjacencyIndices(tail, tail.empty() ? 0 : tail.back() + 1);
     std::vector<EdgeId> arcPath;
     arcPath.resize(vertexPath.size() - 1);
-    for (unsigned i = 0; i < vertexPath.size() - 1; ++i)
-        arcPath.push_back(findEdge(tail, head, vertexPath[i], vertexPath[i + 1]));
+    for (std::size_t i = 0; i < vertexPath.size() - 1; ++i)
+        arcPath.push_back(findEdge(adjacencyIndices, head, vertexPath[i], vertexPath[i + 1]));
     return arcPath;
 }
 
+
+std::vector<OptimizedKit::VertexId> OptimizedKit::computeStronglyConnectedComponents(VertexId vertexCount,
+                                                                                 const std::vector<VertexId> &tail,
+                                                                       const std::vector<VertexId> &head) {
+    assert(tail.size() == head.size());
+
+    // Build an adjacency array, the edge list is not required to be sorted.
+    std::vector<EdgeId> adjacencyIndices(vertexCount + 1, 0);
+    for (auto x : tail)
+        ++adjacencyIndices[x + 1];
+    for (VertexId x = 0; x < vertexCount; ++x)
+        adjacencyIndices[x + 1] += adjacencyIndices[x];
+    std::vector<VertexId> adjacentHead(head.size());
+    std::vector<EdgeId> nextEdge(adjacencyIndices.begin(), adjacencyIndices.end() - 1);
+    for (EdgeId edge = 0; edge < tail.size(); ++edge)
+        adjacentHead[nextEdge[tail[edge]]++] = head[edge];
+
+    // Iterative Tarjan, components are completed sinks first which yields the reverse topological numbering.
+    std::vector<VertexId> component(vertexCount, INVALID_VALUE<VertexId>);
+    std::vector<VertexId> discovery(vertexCount, INVALID_VALUE<VertexId>);
+    std::vector<VertexId> lowLink(vertexCount);
+    std::vector<VertexId> vertexStack;
+    std::vector<VertexId> callStack;
+    VertexId discoveryCount = 0;
+    VertexId componentCount = 0;
+    for (VertexId root = 0; root < vertexCount; ++root) {
+        if (discovery[root] != INVALID_VALUE<VertexId>)
+            continue;
+        discovery[root] = lowLink[root] = discoveryCount++;
+        vertexStack.push_back(root);
+        callStack.push_back(root);
+        nextEdge[root] = adjacencyIndices[root];
+        while (!callStack.empty()) {
+            VertexId x = callStack.back();
+            if (nextEdge[x] < adjacencyIndices[x + 1]) {
+                VertexId y = adjacentHead[nextEdge[x]++];
+                if (discovery[y] == INVALID_VALUE<VertexId>) {
+                    discovery[y] = lowLink[y] = discoveryCount++;
+                    vertexStack.push_back(y);
+                    callStack.push_back(y);
+                    nextEdge[y] = adjacencyIndices[y];
+                } else if (component[y] == INVALID_VALUE<VertexId>) {
+                    lowLink[x] = std::min(lowLink[x], discovery[y]);
+                }
+                continue;
+            }
+
+            // All edges of x are explored, close the component if x is its root.
+            callStack.pop_back();
+            if (!callStack.empty())
+                lowLink[callStack.back()] = std::min(lowLink[callStack.back()], lowLink[x]);
+            if (lowLink[x] != discovery[x])
+                continue;
+            VertexId y;
+            do {
+                y = vertexStack.back();
+                vertexStack.pop_back();
+                component[y] = componentCount;
+            } while (y != x);
+            ++componentCount;
+        }
+    }
+    return component;
+}
+
+std::vector<OptimizedKit::VertexId> OptimizedKit::computeWeaklyConnectedComponents(VertexId vertexCount,
+                                                                               const std::vector<VertexId> &tail,
+                                                                     const std::vector<VertexId> &head) {
+    assert(tail.size() == head.size());
+
+    // Union find with path halving, the smaller root always becomes the parent.
+    std::vector<VertexId> parent(vertexCount);
+    for (VertexId x = 0; x < vertexCount; ++x)
+        parent[x] = x;
+    auto find = [&](VertexId x) {
+        while (parent[x] != x) {
+            parent[x] = parent[parent[x]];
+            x = parent[x];
+        }
+        return x;
+    };
+    for (EdgeId edge = 0; edge < tail.size(); ++edge) {
+        VertexId x = find(tail[edge]);
+        VertexId y = find(head[edge]);
+        if (x < y)
+            parent[y] = x;
+        else if (y < x)
+            parent[x] = y;
+    }
+
+    // Number the roots consecutively.
+    std::vector<VertexId> component(vertexCount);
+    VertexId componentCount = 0;
+    for (VertexId x = 0; x < vertexCount; ++x) {
+        VertexId root = find(x);
+        component[x] = root == x ? componentCount++ : component[root];
+    }
+    return component;
+}
+
+std::vector<OptimizedKit::VertexId> OptimizedKit::computeForestPostOrder(const std::vector<VertexId> &parent) {
+    const VertexId vertexCount = parent.size();
+
+    // Subtree sizes bottom up, parents always follow their children.
+    std::vector<VertexId> subtreeSize(vertexCount, 1);
+    for (VertexId x = 0; x < vertexCount; ++x) {
+        assert(parent[x] == INVALID_VALUE<VertexId> || (x < parent[x] && parent[x] < vertexCount));
+        if (parent[x] != INVALID_VALUE<VertexId>)
+            subtreeSize[parent[x]] += subtreeSize[x];
+    }
+
+    // Assign ranges top down from the back, the largest child takes the end of the free range of its parent. The free
+    // range of a vertex ends right before its own new id.
+    std::vector<VertexId> newId(vertexCount);
+    std::vector<VertexId> &freeEnd = subtreeSize;
+    VertexId rootFreeEnd = vertexCount;
+    for (VertexId x = vertexCount; x-- > 0;) {
+        auto size = subtreeSize[x];
+        auto &end = parent[x] == INVALID_VALUE<VertexId> ? rootFreeEnd : freeEnd[parent[x]];
+        newId[x] = end - 1;
+        end -= size;
+        freeEnd[x] = newId[x];
+    }
+    return newId;
+}
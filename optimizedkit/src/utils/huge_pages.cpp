@@ -0,0 +1,72 @@
+#include <new>
+#include <cstdint>
+#include <cassert>
+#include <utils/huge_pages.hpp>
+
+#ifdef __linux__
+#include <sys/mman.h>
+#endif
+
+namespace {
+    std::size_t roundUpToHugePages(std::size_t bytes) {
+        return (bytes + OptimizedKit::HUGE_PAGE_SIZE - 1) / OptimizedKit::HUGE_PAGE_SIZE * OptimizedKit::HUGE_PAGE_SIZE;
+    }
+}
+
+void *OptimizedKit::allocateHugePages(std::size_t bytes, HugePagePolicy policy) {
+    assert(policy != HugePagePolicy::NONE && "Huge pages require a huge page policy.");
+    bytes = roundUpToHugePages(bytes);
+#ifdef __linux__
+    if (policy == HugePagePolicy::EXPLICIT) {
+        void *pointer = mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS | MAP_HUGETLB, -1, 0);
+        if (pointer != MAP_FAILED)
+            return pointer;
+    }
+
+    // Over-map by one huge page and unmap the unaligned head and tail, the remaining mapping is released as a whole.
+    void *mapping = mmap(nullptr, bytes + HUGE_PAGE_SIZE, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (mapping == MAP_FAILED)
+        throw std::bad_alloc();
+    auto begin = reinterpret_cast<std::uintptr_t>(mapping);
+    auto alignedBegin = (begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    if (alignedBegin != begin)
+        munmap(mapping, alignedBegin - begin);
+    if (alignedBegin + bytes != begin + bytes + HUGE_PAGE_SIZE)
+        munmap(reinterpret_cast<void *>(alignedBegin + bytes), begin + HUGE_PAGE_SIZE - alignedBegin);
+    madvise(reinterpret_cast<void *>(alignedBegin), bytes, MADV_HUGEPAGE);
+    return reinterpret_cast<void *>(alignedBegin);
+#else
+    return ::operator new(bytes, std::align_val_t(HUGE_PAGE_SIZE));
+#endif
+}
+
+void OptimizedKit::freeHugePages(void *pointer, std::size_t bytes) noexcept {
+#ifdef __linux__
+    munmap(pointer, roundUpToHugePages(bytes));
+#else
+    ::operator delete(pointer, roundUpToHugePages(bytes), std::align_val_t(HUGE_PAGE_SIZE));
+#endif
+}
+
+std::size_t OptimizedKit::adviseHugePages(const void *data, std::size_t bytes, HugePagePolicy policy) noexcept {
+    if (policy == HugePagePolicy::NONE || data == nullptr)
+        return 0;
+
+    // Only whole huge pages inside the allocation are advised, its unaligned head and tail may share pages with others.
+    auto begin = reinterpret_cast<std::uintptr_t>(data);
+    auto alignedBegin = (begin + HUGE_PAGE_SIZE - 1) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    auto alignedEnd = (begin + bytes) / HUGE_PAGE_SIZE * HUGE_PAGE_SIZE;
+    if (alignedEnd <= alignedBegin)
+        return 0;
+#ifdef __linux__
+    auto *pointer = reinterpret_cast<void *>(alignedBegin);
+    if (madvise(pointer, alignedEnd - alignedBegin, MADV_HUGEPAGE) != 0)
+        return 0;
+#ifdef MADV_COLLAPSE
+    madvise(pointer, alignedEnd - alignedBegin, MADV_COLLAPSE);
+#endif
+    return alignedEnd - alignedBegin;
+#else
+    return 0;
+#endif
+}
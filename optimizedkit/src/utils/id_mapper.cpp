@@ -1,19 +1,19 @@
 #include <utils/id_mapper.hpp>
 
 OptimizedKit::IdMapper::IdMapper(const OptimizedKit::Filter &filter) {
-    unsigned localId = 0;
+    EdgeId localId = 0;
     for (bool globalId : filter) {
         if (globalId) {
             mapping.push_back(localId);
             ++localId;
         } else {
-            mapping.push_back(-1);
+            mapping.push_back(INVALID_VALUE<EdgeId>);
         }
     }
     localIdCount = localId;
 }
 
-unsigned OptimizedKit::IdMapper::toLocal(unsigned globalId) const {
+OptimizedKit::EdgeId OptimizedKit::IdMapper::toLocal(EdgeId globalId) const {
     assert(globalId < mapping.size());
     return mapping[globalId];
 }
@@ -22,3 +22,7 @@ void OptimizedKit::IdMapper::remove(const OptimizedKit::Filter &filter) {
     removeElementsByFilterInplace(mapping, filter);
     localIdCount -= std::count(filter.begin(), filter.end(), true);
 }
+
+OptimizedKit::MemoryUsage OptimizedKit::IdMapper::memoryUsage() const {
+    return MemoryUsage().add("mapping", mapping);
+}
@@ -0,0 +1,49 @@
+#include <utils/memory_tracker.hpp>
+
+void OptimizedKit::MemoryTracker::recordAllocation(std::size_t bytes) noexcept {
+    auto current = live.fetch_add(bytes, std::memory_order_relaxed) + bytes;
+    auto peak = phasePeak.load(std::memory_order_relaxed);
+    while (current > peak && !phasePeak.compare_exchange_weak(peak, current, std::memory_order_relaxed));
+}
+
+void OptimizedKit::MemoryTracker::recordDeallocation(std::size_t bytes) noexcept {
+    live.fetch_sub(bytes, std::memory_order_relaxed);
+}
+
+void OptimizedKit::MemoryTracker::beginPhase(const std::string &name) {
+    if (recording == nullptr)
+        return;
+    endPhase();
+
+    // Record the phase before resetting the peak, the record itself may be a tracked allocation.
+    recording->recordedPhases.push_back({name, 0, 0, 0});
+    auto start = liveBytes();
+    recording->recordedPhases.back().startBytes = start;
+    phasePeak.store(start, std::memory_order_relaxed);
+    recording->isPhaseRunning = true;
+}
+
+void OptimizedKit::MemoryTracker::endPhase() {
+    if (recording == nullptr || !recording->isPhaseRunning)
+        return;
+    recording->recordedPhases.back().peakBytes = phasePeak.load(std::memory_order_relaxed);
+    recording->recordedPhases.back().endBytes = liveBytes();
+    recording->isPhaseRunning = false;
+}
+
+OptimizedKit::MemoryPhaseRecording::MemoryPhaseRecording() : lock(MemoryTracker::recordingMutex) {
+    MemoryTracker::recording = this;
+}
+
+OptimizedKit::MemoryPhaseRecording::~MemoryPhaseRecording() {
+    MemoryTracker::recording = nullptr;
+}
+
+std::vector<OptimizedKit::MemoryPhase> OptimizedKit::MemoryPhaseRecording::phases() const {
+    auto result = recordedPhases;
+    if (isPhaseRunning) {
+        result.back().peakBytes = MemoryTracker::phasePeak.load(std::memory_order_relaxed);
+        result.back().endBytes = MemoryTracker::liveBytes();
+    }
+    return result;
+}
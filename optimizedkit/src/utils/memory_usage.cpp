@@ -0,0 +1,36 @@
+#include <utils/memory_usage.hpp>
+
+OptimizedKit::MemoryUsage &OptimizedKit::MemoryUsage::add(std::string name, std::size_t bytes) {
+    arrays.emplace_back(std::move(name), bytes);
+    return *this;
+}
+
+OptimizedKit::MemoryUsage &OptimizedKit::MemoryUsage::add(std::string name, const std::vector<bool> &vector) {
+    return add(std::move(name), (vector.capacity() + 7) / 8);
+}
+
+OptimizedKit::MemoryUsage &OptimizedKit::MemoryUsage::add(const std::string &prefix, const MemoryUsage &nested) {
+    for (const auto &[name, bytes]: nested.arrays)
+        add(prefix + "." + name, bytes);
+    return *this;
+}
+
+std::size_t OptimizedKit::MemoryUsage::totalBytes() const {
+    std::size_t total = 0;
+    for (const auto &array: arrays)
+        total += array.second;
+    return total;
+}
+
+std::size_t OptimizedKit::MemoryUsage::bytesOf(const std::string &name) const {
+    for (const auto &[arrayName, bytes]: arrays)
+        if (arrayName == name)
+            return bytes;
+    return 0;
+}
+
+std::ostream &OptimizedKit::operator<<(std::ostream &stream, const MemoryUsage &usage) {
+    for (const auto &[name, bytes]: usage.arrays)
+        stream << name << ": " << bytes << " bytes\n";
+    return stream << "total: " << usage.totalBytes() << " bytes\n";
+}
@@ -0,0 +1,74 @@
+#include <fstream>
+#include <sstream>
+#include <thread>
+#include <algorithm>
+#include <utils/numa_topology.hpp>
+#include <utils/constants.hpp>
+
+#ifdef __linux__
+#include <pthread.h>
+#include <sched.h>
+#endif
+
+std::vector<unsigned> OptimizedKit::parseCpuList(const std::string &cpuList) {
+    std::vector<unsigned> cpus;
+    std::stringstream stream(cpuList);
+    std::string range;
+    while (std::getline(stream, range, ',')) {
+        if (range.empty() || range == "\n")
+            continue;
+        auto dash = range.find('-');
+        unsigned first = std::stoul(range.substr(0, dash));
+        unsigned last = dash == std::string::npos ? first : std::stoul(range.substr(dash + 1));
+        for (unsigned cpu = first; cpu <= last; ++cpu)
+            cpus.push_back(cpu);
+    }
+    return cpus;
+}
+
+std::vector<std::vector<unsigned>> OptimizedKit::numaNodeCpus() {
+    std::vector<std::vector<unsigned>> nodes;
+    std::ifstream online("/sys/devices/system/node/online");
+    std::string onlineNodes;
+    if (online && std::getline(online, onlineNodes)) {
+        for (auto node: parseCpuList(onlineNodes)) {
+            std::ifstream cpuListFile("/sys/devices/system/node/node" + std::to_string(node) + "/cpulist");
+            std::string cpuList;
+            if (cpuListFile && std::getline(cpuListFile, cpuList)) {
+                auto cpus = parseCpuList(cpuList);
+                if (!cpus.empty())
+                    nodes.push_back(std::move(cpus));
+            }
+        }
+    }
+
+    // Without NUMA information all cpus form a single node.
+    if (nodes.empty()) {
+        nodes.emplace_back();
+        for (unsigned cpu = 0; cpu < std::max(1u, std::thread::hardware_concurrency()); ++cpu)
+            nodes.back().push_back(cpu);
+    }
+    return nodes;
+}
+
+bool OptimizedKit::pinCurrentThread(const std::vector<unsigned> &cpus) {
+#ifdef __linux__
+    cpu_set_t set;
+    CPU_ZERO(&set);
+    for (auto cpu: cpus)
+        if (cpu < CPU_SETSIZE)
+            CPU_SET(cpu, &set);
+    return !cpus.empty() && pthread_setaffinity_np(pthread_self(), sizeof(set), &set) == 0;
+#else
+    return false;
+#endif
+}
+
+unsigned OptimizedKit::currentCpu() {
+#ifdef __linux__
+    int cpu = sched_getcpu();
+    return cpu < 0 ? INVALID_VALUE<unsigned> : static_cast<unsigned>(cpu);
+#else
+    return INVALID_VALUE<unsigned>;
+#endif
+}
@@ -1,6 +1,6 @@
 #include "utils/permutation.hpp"
 
-std::vector<unsigned> OptimizedKit::computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(
+std::vector<OptimizedKit::EdgeId> OptimizedKit::computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(
         std::vector<VertexId> &tail,
         const std::vector<VertexId> &head
 ) {
@@ -12,7 +12,7 @@ std::vector<unsigned> OptimizedKit::computeInverseSortPermutationFirstByTailThen
     return chainPermutationFirstLeftThenRight(q, p);
 }
 
-std::vector<unsigned> OptimizedKit::computeSortPermutationFirstByTailThenByHeadAndApplySortToTail(
+std::vector<OptimizedKit::EdgeId> OptimizedKit::computeSortPermutationFirstByTailThenByHeadAndApplySortToTail(
         std::vector<VertexId> &tail,
         const std::vector<VertexId> &head
 ) {
@@ -24,30 +24,30 @@ std::vector<unsigned> OptimizedKit::computeSortPermutationFirstByTailThenByHeadA
     return chainPermutationFirstLeftThenRight(p, q);
 }
 
-void OptimizedKit::inplaceApplyPermutationToElementsOf(const std::vector<unsigned> &p, std::vector<unsigned> &v) {
+void OptimizedKit::inplaceApplyPermutationToElementsOf(const std::vector<VertexId> &p, std::vector<VertexId> &v) {
     assert(isPermutation(p) && "p must be a permutation");
-    assert(std::all_of(v.begin(), v.end(), [&](unsigned x) { return x < p.size(); }) &&
+    assert(std::all_of(v.begin(), v.end(), [&](VertexId x) { return x < p.size(); }) &&
            "v has an out of bounds element");
-    for (unsigned int &i: v)
+    for (VertexId &i: v)
         i = p[i];
 }
 
-std::vector<unsigned>
-OptimizedKit::applyPermutationToElementsOf(const std::vector<unsigned> &p, const std::vector<unsigned> &v) {
+std::vector<OptimizedKit::VertexId>
+OptimizedKit::applyPermutationToElementsOf(const std::vector<VertexId> &p, const std::vector<VertexId> &v) {
     assert(isPermutation(p) && "p must be a permutation");
-    assert(std::all_of(v.begin(), v.end(), [&](unsigned x) { return x < p.size(); }) && "v has an out of bounds element");
-    std::vector<unsigned> r = v;
+    assert(std::all_of(v.begin(), v.end(), [&](VertexId x) { return x < p.size(); }) && "v has an out of bounds element");
+    std::vector<VertexId> r = v;
     inplaceApplyPermutationToElementsOf(p, r);
     return r;
 }
 
-std::vector<unsigned>
-OptimizedKit::chainPermutationFirstLeftThenRight(const std::vector<unsigned> &p, const std::vector<unsigned> &q) {
+std::vector<OptimizedKit::EdgeId>
+OptimizedKit::chainPermutationFirstLeftThenRight(const std::vector<EdgeId> &p, const std::vector<EdgeId> &q) {
     assert(isPermutation(p) && "p must be a permutation");
     assert(isPermutation(q) && "q must be a permutation");
     assert(p.size() == q.size() && "p and q must permute the same number of objects");
-    std::vector<unsigned> r(p.size());
-    for (unsigned i = 0; i < r.size(); ++i)
+    std::vector<EdgeId> r(p.size());
+    for (std::size_t i = 0; i < r.size(); ++i)
         r[i] = p[q[i]];
     return r;
 }
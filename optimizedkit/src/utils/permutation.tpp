@@ -3,7 +3,7 @@
 template<class P>
 bool OptimizedKit::isPermutation(const std::vector<P> &p) {
     std::vector<bool> found(p.size(), false);
-    for (unsigned x: p) {
+    for (P x: p) {
         if (x >= p.size())
             return false;
         if (found[x])
@@ -18,7 +18,7 @@ std::vector<V> OptimizedKit::applyPermutation(const std::vector<P> &p, const std
     assert(isPermutation(p) && "p must be a permutation");
     assert(p.size() == v.size() && "permutation and vector must have the same size");
     std::vector<V> r(v.size());
-    for (unsigned i = 0; i < v.size(); ++i)
+    for (std::size_t i = 0; i < v.size(); ++i)
         r[i] = v[p[i]];
     return r;
 }
@@ -36,8 +36,8 @@ std::vector<V> OptimizedKit::applyPermutation(const std::vector<P> &p, std::vect
 template<class P>
 std::vector<P> OptimizedKit::invertPermutation(const std::vector<P> &p) {
     assert(isPermutation(p) && "p must be a permutation");
-    std::vector<unsigned> invP(p.size());
-    for (unsigned i = 0; i < p.size(); ++i)
+    std::vector<P> invP(p.size());
+    for (P i = 0; i < p.size(); ++i)
         invP[p[i]] = i;
     return invP;
 }
@@ -63,7 +63,7 @@ std::vector<V> OptimizedKit::applyInversePermutation(const std::vector<P> &p, st
 }
 
 template<class P>
-std::vector<P> OptimizedKit::identityPermutation(unsigned int n) {
+std::vector<P> OptimizedKit::identityPermutation(std::size_t n) {
     std::vector<P> p(n);
     for (P i = 0; i < n; ++i)
         p[i] = i;
@@ -71,17 +71,17 @@ std::vector<P> OptimizedKit::identityPermutation(unsigned int n) {
 }
 
 template<class V>
-std::vector<unsigned>
+std::vector<OptimizedKit::EdgeId>
 OptimizedKit::computeStableSortPermutation(const std::vector<V> &v) {
-    std::vector <unsigned> p(v.size());
-    for (unsigned i = 0; i < v.size(); ++i)
+    std::vector<EdgeId> p(v.size());
+    for (EdgeId i = 0; i < v.size(); ++i)
         p[i] = i;
-    std::stable_sort(p.begin(), p.end(), [&](unsigned i, unsigned j) { return v[i] < v[j]; });
+    std::stable_sort(p.begin(), p.end(), [&](EdgeId i, EdgeId j) { return v[i] < v[j]; });
     return p;
 }
 
 template<class V>
-std::vector<unsigned>
+std::vector<OptimizedKit::EdgeId>
 OptimizedKit::computeInverseStableSortPermutation(const std::vector<V> &v) {
     return invertPermutation(computeStableSortPermutation(v));
 }
@@ -0,0 +1,39 @@
+#include <utils/rank_bit_vector.hpp>
+
+OptimizedKit::RankBitVector::RankBitVector(const OptimizedKit::Filter &filter) {
+    bitCount = filter.size();
+
+    // One block more than filled keeps rank queries of the size in bounds.
+    blocks.assign(blockOffset(bitCount) + 1 + WORDS_PER_BLOCK, 0);
+    for (EdgeId id = 0; id < bitCount; ++id)
+        if (filter[id])
+            blocks[blockOffset(id) + 1 + id / 64 % WORDS_PER_BLOCK] |= std::uint64_t{1} << (id % 64);
+
+    // The low 40 bits hold the rank before the block, the byte 4 + i the rank of word i > 0 within the block.
+    std::uint64_t setBits = 0;
+    for (std::size_t block = 0; block < blocks.size(); block += 1 + WORDS_PER_BLOCK) {
+        assert(setBits <= BLOCK_RANK_MASK);
+        auto ranks = setBits;
+        unsigned inBlock = 0;
+        for (unsigned word = 0; word < WORDS_PER_BLOCK; ++word) {
+            if (word > 0)
+                ranks |= std::uint64_t{inBlock} << (32 + 8 * word);
+            inBlock += std::popcount(blocks[block + 1 + word]);
+        }
+        blocks[block] = ranks;
+        setBits += inBlock;
+    }
+}
+
+void OptimizedKit::RankBitVector::remove(const OptimizedKit::Filter &filter) {
+    assert(filter.size() == bitCount);
+    Filter remaining;
+    for (EdgeId id = 0; id < bitCount; ++id)
+        if (!filter[id])
+            remaining.push_back((*this)[id]);
+    *this = RankBitVector(remaining);
+}
+
+OptimizedKit::MemoryUsage OptimizedKit::RankBitVector::memoryUsage() const {
+    return MemoryUsage().add("blocks", blocks);
+}
@@ -12,11 +12,11 @@ void OptimizedKit::printVectorToConsole(const std::vector<T> &vector, const std:
 }
 
 template<typename V>
-std::vector<V> OptimizedKit::constructAdjacencyIndices(const std::vector<V> &v, unsigned edgeCount) {
-    std::vector<unsigned> index(edgeCount + 1);
+std::vector<OptimizedKit::EdgeId> OptimizedKit::constructAdjacencyIndices(const std::vector<V> &v, std::size_t edgeCount) {
+    std::vector<EdgeId> index(edgeCount + 1);
     assert(v.empty() || (OptimizedKit::isVectorSorted(v) && OptimizedKit::maxElementOfVector(v) < edgeCount));
-    unsigned pos = 0;
-    for (unsigned i = 0; i < edgeCount; ++i) {
+    EdgeId pos = 0;
+    for (std::size_t i = 0; i < edgeCount; ++i) {
         while (pos < v.size() && v[pos] < i)
             ++pos;
         index[i] = pos;
@@ -44,23 +44,43 @@ void OptimizedKit::removeElementsByFilterInplace(std::vector<T> &vector, Filter
                  vector.end());
 }
 
+template<typename I, typename T>
+void OptimizedKit::removeAdjacencyListsByFilter(std::vector<I> &adjacencyIndices, std::vector<T> &elements,
+                                                const Filter &filter) {
+    assert(filter.size() + 1 == adjacencyIndices.size() && "Filter and adjacency indices mismatch");
+    I elementCount = 0;
+    std::size_t listCount = 0;
+    for (std::size_t list = 0; list < filter.size(); ++list) {
+        auto begin = adjacencyIndices[list];
+        auto end = adjacencyIndices[list + 1];
+        if (filter[list])
+            continue;
+        adjacencyIndices[listCount++] = elementCount;
+        for (auto index = begin; index < end; ++index)
+            elements[elementCount++] = elements[index];
+    }
+    adjacencyIndices[listCount] = elementCount;
+    adjacencyIndices.resize(listCount + 1);
+    elements.resize(elementCount);
+}
+
 template<typename T>
 void OptimizedKit::adjustElementsToRemoveFilterInPlace(std::vector<T> &vector, Filter filter) {
-    for (unsigned currId = 0; currId < vector.size(); currId++) {
+    for (std::size_t currId = 0; currId < vector.size(); currId++) {
         // Check for invalid values (e.g. for loops in the input graph)
-        if (vector[currId] == OptimizedKit::INVALID_VALUE<unsigned>)
+        if (vector[currId] == OptimizedKit::INVALID_VALUE<T>)
             continue;
 
         // Check if cch edge is removed.
-        assert(vector[currId] < filter.size() - 1);
+        assert(vector[currId] < filter.size());
         if (filter[vector[currId]]){
-            vector[currId] = OptimizedKit::INVALID_VALUE<unsigned>;
+            vector[currId] = OptimizedKit::INVALID_VALUE<T>;
             continue;
         }
 
         // Lower saved cch edge id by the number of removed edges for each lower id.
         T offset = 0;
-        for (unsigned lowerId = 0; lowerId < vector[currId]; lowerId++) {
+        for (T lowerId = 0; lowerId < vector[currId]; lowerId++) {
             if (filter[lowerId])
                 offset++;
         }
@@ -84,4 +104,9 @@ std::vector<T> readVectorFromBinaryFile(const std::string &filePath) {
     in.read(reinterpret_cast<char *>(data.data()), size);
     in.close();
     return data;
-}
\ No newline at end of file
+}
+
+template<typename T>
+void OptimizedKit::releaseVector(std::vector<T> &vector) {
+    std::vector<T>().swap(vector);
+}
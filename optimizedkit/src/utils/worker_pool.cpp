@@ -0,0 +1,51 @@
+#include "utils/worker_pool.hpp"
+
+OptimizedKit::WorkerPool::WorkerPool(unsigned threadCount) {
+    workers.reserve(threadCount > 1 ? threadCount - 1 : 0);
+    for (unsigned thread = 1; thread < threadCount; ++thread)
+        workers.emplace_back(&WorkerPool::work, this, thread);
+}
+
+OptimizedKit::WorkerPool::~WorkerPool() {
+    {
+        std::lock_guard lock(mutex);
+        stopping = true;
+    }
+    taskReady.notify_all();
+    for (auto &worker: workers)
+        worker.join();
+}
+
+void OptimizedKit::WorkerPool::run(const std::function<void(unsigned)> &task) {
+    std::lock_guard runLock(runMutex);
+    if (!workers.empty()) {
+        std::lock_guard lock(mutex);
+        currentTask = &task;
+        pendingWorkers = workers.size();
+        ++generation;
+    }
+    taskReady.notify_all();
+    task(0);
+    std::unique_lock lock(mutex);
+    taskDone.wait(lock, [&] { return pendingWorkers == 0; });
+    currentTask = nullptr;
+}
+
+void OptimizedKit::WorkerPool::work(unsigned thread) {
+    unsigned long long seenGeneration = 0;
+    while (true) {
+        const std::function<void(unsigned)> *task;
+        {
+            std::unique_lock lock(mutex);
+            taskReady.wait(lock, [&] { return stopping || generation != seenGeneration; });
+            if (stopping)
+                return;
+            seenGeneration = generation;
+            task = currentTask;
+        }
+        (*task)(thread);
+        std::lock_guard lock(mutex);
+        if (--pendingWorkers == 0)
+            taskDone.notify_one();
+    }
+}
@@ -0,0 +1,144 @@
+#include <gtest/gtest.h>
+#include <numeric>
+#include "graph/graph.hpp"
+#include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
+#include "customizable_contraction_hierarchy/cch_core_reduction.hpp"
+#include "customizable_contraction_hierarchy/cch_core_query.hpp"
+
+class CchCoreReductionTest : public ::testing::Test {
+protected:
+    OptimizedKit::Graph graph;
+    std::vector<unsigned> weights;
+    std::vector<OptimizedKit::VertexId> order;
+
+    void addEdges(OptimizedKit::VertexId x, OptimizedKit::VertexId y, unsigned forward, unsigned backward) {
+        graph.addEdge(x, y);
+        weights.push_back(forward);
+        graph.addEdge(y, x);
+        weights.push_back(backward);
+    }
+
+    void addEdge(OptimizedKit::VertexId x, OptimizedKit::VertexId y, unsigned weight) {
+        graph.addEdge(x, y);
+        weights.push_back(weight);
+    }
+
+    // Core vertices 0 and 2 with the chains 0-1-2, 0-3-2 and 2-6-7-4-0, a tree 5-8-{9,10} hanging off the chain
+    // vertex 4 and a tree 11 hanging off the chain vertex 1. A cycle 12-13-14, a tree 15-16-17 and an isolated vertex
+    // 18 form further components.
+    void SetUp() override {
+        addEdges(0, 1, 2, 3);
+        addEdges(1, 2, 4, 1);
+        addEdges(2, 3, 5, 2);
+        addEdges(3, 0, 1, 6);
+        addEdge(0, 2, 9);
+        addEdge(3, 3, 1);
+        addEdges(2, 6, 1, 1);
+        addEdge(6, 7, 2);
+        addEdge(7, 6, 7);
+        addEdge(7, 6, 3);
+        addEdges(7, 4, 2, 2);
+        addEdges(4, 0, 3, 1);
+        addEdges(4, 5, 1, 4);
+        addEdges(5, 8, 2, 2);
+        addEdges(8, 9, 1, 3);
+        addEdges(8, 10, 5, 1);
+        addEdge(11, 1, 2);
+        addEdges(12, 13, 1, 2);
+        addEdge(13, 14, 3);
+        addEdges(14, 12, 2, 2);
+        addEdges(15, 16, 1, 1);
+        addEdges(16, 17, 2, 3);
+        graph.vertexCount = 19;
+        order.resize(graph.vertexCount);
+        std::iota(order.rbegin(), order.rend(), 0);
+    }
+
+    void expectSameQueryResultsAsInputCch(const std::vector<unsigned> &inputWeights) {
+        OptimizedKit::CchPreprocessor preprocessor(order, graph);
+        OptimizedKit::CchCustomizer customizer(preprocessor, inputWeights);
+        customizer.baseCustomization();
+        OptimizedKit::CchQuery query(customizer);
+        OptimizedKit::CchCoreReduction reduction(graph);
+        auto coreWeights = reduction.reduceWeights(inputWeights);
+        OptimizedKit::CchPreprocessor corePreprocessor(reduction.reduceOrder(order), reduction.coreGraph);
+        OptimizedKit::CchCustomizer coreCustomizer(corePreprocessor, coreWeights);
+        coreCustomizer.baseCustomization();
+        OptimizedKit::CchCoreQuery coreQuery(reduction, coreCustomizer, inputWeights);
+
+        for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+            for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+                query.run(source, target);
+                coreQuery.run(source, target);
+                ASSERT_EQ(coreQuery.getQueryWeight(), query.getQueryWeight()) << source << " -> " << target;
+                if (coreQuery.getQueryWeight() == OptimizedKit::INFINITY_WEIGHT<unsigned>)
+                    continue;
+
+                // The path is connected, leads from source to target and has the query weight.
+                auto edgePath = coreQuery.getEdgePath();
+                auto vertexPath = coreQuery.getVertexPath();
+                unsigned pathWeight = 0;
+                for (std::size_t i = 0; i < edgePath.size(); ++i) {
+                    ASSERT_EQ(graph.tail[edgePath[i]], vertexPath[i]);
+                    pathWeight += inputWeights[edgePath[i]];
+                }
+                ASSERT_EQ(vertexPath.front(), source);
+                ASSERT_EQ(vertexPath.back(), target);
+                ASSERT_EQ(pathWeight, coreQuery.getQueryWeight());
+            }
+        }
+    }
+};
+
+TEST_F(CchCoreReductionTest, Reduce_WithTreesChainsAndCycles_KeepsOnlyBranchingVertices) {
+    // Arrange
+    std::vector<OptimizedKit::VertexId> expectedCoreVertices = {0, 2, 12, 15, 18};
+
+    // Act
+    OptimizedKit::CchCoreReduction reduction(graph);
+
+    // Assert
+    ASSERT_EQ(reduction.inputVertexOfCoreVertex, expectedCoreVertices);
+    ASSERT_EQ(reduction.treeAnchor[9], 4);
+    ASSERT_EQ(reduction.treeAnchor[11], 1);
+    ASSERT_EQ(reduction.treeAnchor[17], 15);
+    ASSERT_EQ(reduction.chainOfVertex[4], reduction.chainOfVertex[6]);
+    ASSERT_NE(reduction.chainOfVertex[13], OptimizedKit::INVALID_VALUE<OptimizedKit::VertexId>);
+
+    // The edge 0->2 and both directions of the three chains between 0 and 2, the cycle needs no core edge.
+    ASSERT_EQ(reduction.coreGraph.getEdgeCount(), 7);
+    ASSERT_EQ(reduction.reduceOrder(order), std::vector<OptimizedKit::VertexId>({4, 3, 2, 1, 0}));
+}
+
+TEST_F(CchCoreReductionTest, ReduceWeights_ChainWithParallelEdges_SumsCheapestEdgeOfEveryHop) {
+    // Arrange
+    OptimizedKit::CchCoreReduction reduction(graph);
+
+    // Act
+    auto coreWeights = reduction.reduceWeights(weights);
+
+    // Assert, 2->6->7->4->0 costs 1 + 2 + 2 + 3 and 0->4->7->6->2 costs 1 + 2 + 3 + 1.
+    for (OptimizedKit::EdgeId coreEdge = 0; coreEdge < reduction.coreGraph.getEdgeCount(); ++coreEdge) {
+        if (reduction.chainOfCoreEdge[coreEdge] != reduction.chainOfVertex[6])
+            continue;
+        ASSERT_EQ(coreWeights[coreEdge], reduction.coreGraph.tail[coreEdge] == 0 ? 7 : 8);
+    }
+}
+
+TEST_F(CchCoreReductionTest, Query_AllPairs_SameQueryResultAsCchOnInputGraph) {
+    expectSameQueryResultsAsInputCch(weights);
+}
+
+TEST_F(CchCoreReductionTest, Query_AfterWeightChanges_SameQueryResultAsCchOnInputGraph) {
+    // Arrange, make the edge 0->2 and the chain 2-6-7-4-0 cheap and close 1->0.
+    auto changedWeights = weights;
+    changedWeights[8] = 1;
+    for (OptimizedKit::EdgeId edge = 10; edge < 18; ++edge)
+        changedWeights[edge] = 1;
+    changedWeights[1] = OptimizedKit::INFINITY_WEIGHT<unsigned>;
+
+    // Act & Assert
+    expectSameQueryResultsAsInputCch(changedWeights);
+}
@@ -130,7 +130,7 @@ TEST(CchCustomizerTest, PerfectCustomize_WithMockGraph_RemovesEdges) {
 
     // Act
     customizer.perfectCustomization();
-    auto sizePostCustomization = preprocessor.cchEdgeCount();
+    auto sizePostCustomization = customizer.getQueryGraph()->arcCount();
 
     // Assert
     ASSERT_LE(sizePostCustomization, sizePreCustomization);
@@ -171,7 +171,7 @@ TEST(CchCustomizerTest, PerfectCustomize_WithOsmMap_RemovesEdges){
 
     // Act
     customizer.perfectCustomization();
-    auto sizePostCustomization = preprocessor.cchEdgeCount();
+    auto sizePostCustomization = customizer.getQueryGraph()->arcCount();
 
     // Assert
     ASSERT_LE(sizePostCustomization, sizePreCustomization);
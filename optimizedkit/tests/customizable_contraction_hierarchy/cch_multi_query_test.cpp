@@ -0,0 +1,106 @@
+#include <gtest/gtest.h>
+#include "graph/graph.hpp"
+#include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
+#include "../test_utils/small_graph_fixture.hpp"
+
+class CchMultiQueryTest : public SmallGraphTest {
+};
+
+TEST_F(CchMultiQueryTest, Run_SourceOffsets_UsesCheapestSource) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<std::pair<OptimizedKit::VertexId, unsigned>> sources = {{0, 10}, {1, 0}};
+    std::vector<std::pair<OptimizedKit::VertexId, unsigned>> targets = {{5, 0}, {4, 2}};
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {3, 4, 6, 9};
+
+    // Act
+    query.run(sources, targets);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 4);
+    ASSERT_EQ(query.getSource(), 1);
+    ASSERT_EQ(query.getTarget(), 5);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+}
+
+TEST_F(CchMultiQueryTest, Run_DistanceOnlyMode_UsesCheapestTarget) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    query.setQueryMode(OptimizedKit::QueryMode::DISTANCE_ONLY);
+    std::vector<std::pair<OptimizedKit::VertexId, unsigned>> sources = {{0, 0}, {1, 5}};
+    std::vector<std::pair<OptimizedKit::VertexId, unsigned>> targets = {{5, 0}, {4, 0}};
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {0, 3, 4, 6};
+    std::vector<OptimizedKit::VertexId> expectedVertexPath = {0, 1, 2, 3, 4};
+
+    // Act
+    query.run(sources, targets);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 4);
+    ASSERT_EQ(query.getSource(), 0);
+    ASSERT_EQ(query.getTarget(), 4);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(query.getVertexPath(), expectedVertexPath);
+}
+
+TEST_F(CchMultiQueryTest, Run_EdgePositions_AddsPartialEdgeWeights) {
+    // Arrange
+    std::vector<unsigned> scaledWeights = {10, 30, 30, 10, 10, 30, 10, 40, 10, 10};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, scaledWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {3, 4, 6, 9};
+    std::vector<OptimizedKit::VertexId> expectedVertexPath = {2, 3, 4};
+
+    // Act
+    query.run(OptimizedKit::EdgePosition{3, 0.5}, OptimizedKit::EdgePosition{9, 0.5});
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 30);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(query.getVertexPath(), expectedVertexPath);
+}
+
+TEST_F(CchMultiQueryTest, Run_SameEdgeTargetAhead_StaysOnEdge) {
+    // Arrange
+    std::vector<unsigned> scaledWeights = {10, 30, 30, 10, 10, 30, 10, 40, 10, 10};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, scaledWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {7};
+
+    // Act
+    query.run(OptimizedKit::EdgePosition{7, 0.25}, OptimizedKit::EdgePosition{7, 0.75});
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 20);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+    ASSERT_TRUE(query.getVertexPath().empty());
+}
+
+TEST_F(CchMultiQueryTest, Run_SameEdgeTargetBehind_LeavesAndReentersEdge) {
+    // Arrange
+    std::vector<unsigned> scaledWeights = {10, 30, 30, 10, 10, 30, 10, 40, 10, 10};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, scaledWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {6, 8, 6};
+
+    // Act
+    query.run(OptimizedKit::EdgePosition{6, 0.8}, OptimizedKit::EdgePosition{6, 0.2});
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 14);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+}
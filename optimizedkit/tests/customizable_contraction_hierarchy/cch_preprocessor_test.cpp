@@ -1,6 +1,8 @@
 #include <gtest/gtest.h>
 #include "graph/graph.hpp"
 #include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
 #include <routingkit/customizable_contraction_hierarchy.h>
 #include "map/csv_reader.hpp"
 #include "../test_utils/utils.hpp"
@@ -158,4 +160,65 @@ TEST(CchPreprocessorTest, Preprocess_WithMockGraph_ExpectSamePreprocessingAsRout
     for (int i = 0; i < routingKitCch.extra_backward_input_arc_of_cch.size(); ++i) {
         EXPECT_EQ(routingKitCch.extra_backward_input_arc_of_cch[i], preprocessor.extraBackwardInputEdgeOfCch[i]) << "Vectors routingKitCch.extra_backward_input_arc_of_cch and preprocessor.extraBackwardInputArcOfCch differ at index " << i;
     }
-}
\ No newline at end of file
+}
+
+TEST(CchPreprocessorTest, Preprocess_WithEliminationTreeLayout_SameQueryResultAsRankLayout) {
+    // Arrange, a grid with a scattered order whose elimination tree is not stored in post-order.
+    const OptimizedKit::VertexId width = 6;
+    OptimizedKit::Graph grid;
+    std::vector<unsigned> gridWeights;
+    for (OptimizedKit::VertexId x = 0; x < width * width; ++x) {
+        if (x % width + 1 < width) {
+            grid.addEdge(x, x + 1);
+            grid.addEdge(x + 1, x);
+            gridWeights.insert(gridWeights.end(), {static_cast<unsigned>(1 + x % 7), static_cast<unsigned>(1 + x % 5)});
+        }
+        if (x + width < width * width) {
+            grid.addEdge(x, x + width);
+            grid.addEdge(x + width, x);
+            gridWeights.insert(gridWeights.end(), {static_cast<unsigned>(1 + x % 3), static_cast<unsigned>(2 + x % 4)});
+        }
+    }
+    grid.vertexCount = width * width;
+    std::vector<OptimizedKit::VertexId> gridOrder(width * width);
+    for (OptimizedKit::VertexId i = 0; i < width * width; ++i)
+        gridOrder[i] = i * 7 % (width * width);
+    OptimizedKit::CchPreprocessor preprocessor(gridOrder, grid);
+    OptimizedKit::CchCustomizer customizer(preprocessor, gridWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+
+    // Act
+    OptimizedKit::CchPreprocessor laidOutPreprocessor(gridOrder, grid, OptimizedKit::CchVertexLayout::ELIMINATION_TREE);
+    OptimizedKit::CchCustomizer laidOutCustomizer(laidOutPreprocessor, gridWeights);
+    laidOutCustomizer.baseCustomization();
+    OptimizedKit::CchQuery laidOutQuery(laidOutCustomizer);
+
+    // Assert, the hierarchy is the same while every subtree of the elimination tree ends at its root.
+    ASSERT_NE(laidOutPreprocessor.order, preprocessor.order);
+    ASSERT_EQ(laidOutPreprocessor.cchEdgeCount(), preprocessor.cchEdgeCount());
+    ASSERT_EQ(laidOutPreprocessor.eliminationTreeLevelCount, preprocessor.eliminationTreeLevelCount);
+    const auto &upwardsGraph = laidOutPreprocessor.upwardsGraph;
+    std::vector<OptimizedKit::VertexId> parent(width * width, OptimizedKit::INVALID_VALUE<OptimizedKit::VertexId>);
+    std::vector<OptimizedKit::VertexId> subtreeSize(width * width, 1);
+    for (OptimizedKit::VertexId x = 0; x < width * width; ++x) {
+        if (upwardsGraph.adjacencyIndices[x] != upwardsGraph.adjacencyIndices[x + 1]) {
+            parent[x] = upwardsGraph.head[upwardsGraph.adjacencyIndices[x]];
+            subtreeSize[parent[x]] += subtreeSize[x];
+        }
+    }
+    for (OptimizedKit::VertexId x = 0; x < width * width; ++x) {
+        if (parent[x] != OptimizedKit::INVALID_VALUE<OptimizedKit::VertexId>) {
+            ASSERT_LE(parent[x] + subtreeSize[x], x + subtreeSize[parent[x]]);
+        }
+    }
+    for (OptimizedKit::VertexId source = 0; source < grid.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < grid.vertexCount; ++target) {
+            query.run(source, target);
+            laidOutQuery.run(source, target);
+            ASSERT_EQ(laidOutQuery.getQueryWeight(), query.getQueryWeight());
+            ASSERT_EQ(laidOutQuery.getVertexPath().front(), source);
+            ASSERT_EQ(laidOutQuery.getVertexPath().back(), target);
+        }
+    }
+}
@@ -0,0 +1,447 @@
+#include <gtest/gtest.h>
+#include "graph/graph.hpp"
+#include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
+#include "customizable_contraction_hierarchy/cch_serving_replicas.hpp"
+#include "utils/lexicographic_weight.hpp"
+#include "../test_utils/small_graph_fixture.hpp"
+
+class CchQueryModeTest : public SmallGraphTest {
+};
+
+TEST_F(CchQueryModeTest, Run_DistanceOnlyMode_PredecessorsNotTracked) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    query.setQueryMode(OptimizedKit::QueryMode::DISTANCE_ONLY);
+
+    // Act
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 5);
+    ASSERT_TRUE(query.biDirectionalDijkstra.forwardPredecessor.empty());
+    ASSERT_TRUE(query.biDirectionalDijkstra.backwardPredecessor.empty());
+}
+
+TEST_F(CchQueryModeTest, GetEdgePath_DistanceOnlyMode_SamePathAsPathMode) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery pathQuery(customizer);
+    OptimizedKit::CchQuery distanceQuery(customizer);
+    distanceQuery.setQueryMode(OptimizedKit::QueryMode::DISTANCE_ONLY);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {0, 3, 4, 6, 9};
+
+    // Act
+    pathQuery.run(0, 5);
+    distanceQuery.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(pathQuery.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(distanceQuery.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(distanceQuery.getVertexPath(), pathQuery.getVertexPath());
+}
+
+TEST_F(CchQueryModeTest, Run_SameSourceAndTargetAfterOtherQuery_EmptyPathOfWeightZero) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+
+    for (auto queryMode: {OptimizedKit::QueryMode::PATH, OptimizedKit::QueryMode::DISTANCE_ONLY}) {
+        OptimizedKit::CchQuery query(customizer);
+        query.setQueryMode(queryMode);
+        query.run(0, 5);
+
+        // Act
+        query.run(3, 3);
+
+        // Assert
+        ASSERT_EQ(query.getQueryWeight(), 0);
+        ASSERT_TRUE(query.getEdgePath().empty());
+        ASSERT_EQ(query.getVertexPath(), std::vector<OptimizedKit::VertexId>{3});
+    }
+}
+
+TEST(CchPathUnpackingTest, GetEdgePath_NestedShortcutsOnTargetSide_UnpacksInTravelDirection) {
+    // Arrange, a one-way chain whose middle vertices are contracted first. The search from 0, ranked highest, meets the
+    // backward search at 0, hence the whole path is unpacked from the shortcut 0-6 over the nested shortcuts 0-4, 0-2,
+    // 2-4 and 4-6 in the backward direction.
+    OptimizedKit::Graph chain;
+    for (OptimizedKit::VertexId x = 0; x < 6; ++x)
+        chain.addEdge(x, x + 1);
+    chain.vertexCount = 7;
+    std::vector<unsigned> chainWeights = {1, 2, 3, 4, 5, 6};
+    std::vector<OptimizedKit::VertexId> chainOrder = {1, 3, 5, 2, 4, 6, 0};
+    OptimizedKit::CchPreprocessor preprocessor(chainOrder, chain);
+    OptimizedKit::CchCustomizer customizer(preprocessor, chainWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {0, 1, 2, 3, 4, 5};
+    std::vector<OptimizedKit::VertexId> expectedVertexPath = {0, 1, 2, 3, 4, 5, 6};
+
+    // Act
+    query.run(0, 6);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 21);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(query.getVertexPath(), expectedVertexPath);
+    ASSERT_EQ(query.setQueryMode(OptimizedKit::QueryMode::DISTANCE_ONLY).run(0, 6).getEdgePath(), expectedEdgePath);
+}
+
+TEST_F(CchQueryModeTest, Query_SeveralQueriesOfCustomizer_ShareOneQueryGraph) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery firstQuery(customizer);
+    OptimizedKit::CchQuery secondQuery(customizer);
+    auto packedGraph = customizer.getQueryGraph();
+
+    // Act
+    weights[5] = 1;
+    customizer.update({5});
+    firstQuery.run(0, 5);
+    secondQuery.run(0, 5);
+
+    // Assert, the graph of the previous metric stays valid for whoever still holds it.
+    ASSERT_NE(firstQuery.biDirectionalDijkstra.queryGraph, packedGraph);
+    ASSERT_EQ(firstQuery.biDirectionalDijkstra.queryGraph, secondQuery.biDirectionalDijkstra.queryGraph);
+    ASSERT_EQ(firstQuery.biDirectionalDijkstra.queryGraph, customizer.getQueryGraph());
+    ASSERT_EQ(firstQuery.getQueryWeight(), 4);
+    ASSERT_EQ(packedGraph->arcs.size(), customizer.getQueryGraph()->arcs.size());
+    ASSERT_EQ(firstQuery.memoryUsage().bytesOf("privateQueryGraph.arcs"), 0);
+}
+
+TEST_F(CchQueryModeTest, GetSecondaryTotals_WithEquallyShortPaths_TotalsOfLexicographicallySmallestPath) {
+    // Arrange
+    weights[1] = 2;
+    std::vector<unsigned> lengths = {10, 5, 10, 10, 10, 10, 10, 10, 10, 10};
+    std::vector<unsigned> tolls = {0, 0, 0, 0, 0, 0, 2, 0, 0, 0};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.setSecondaryAttributes({lengths, tolls}).baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<unsigned> expectedTotals = {35, 2};
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {1, 4, 6, 9};
+
+    // Act
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 5);
+    ASSERT_EQ(query.getSecondaryTotals(), expectedTotals);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+}
+
+TEST_F(CchQueryModeTest, GetSecondaryTotals_WithEquallyShortSearchPaths_TotalsOfLexicographicallySmallestPath) {
+    // Arrange, 0->1->3 and 0->2->3 are equally short and both tight at 3 in the upward search from 0, the first found
+    // predecessor 1 has the larger toll.
+    OptimizedKit::Graph diamond;
+    for (auto [tail, head]: {std::pair{0u, 1u}, {0u, 2u}, {1u, 3u}, {2u, 3u}})
+        diamond.addEdge(tail, head);
+    diamond.vertexCount = 4;
+    std::vector<unsigned> diamondWeights = {1, 1, 1, 1};
+    std::vector<unsigned> tolls = {0, 0, 5, 1};
+    OptimizedKit::CchPreprocessor preprocessor({0, 1, 2, 3}, diamond);
+    OptimizedKit::CchCustomizer customizer(preprocessor, diamondWeights);
+    customizer.setSecondaryAttributes({tolls}).baseCustomization();
+    std::vector<unsigned> expectedTotals = {1};
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {1, 3};
+    std::vector<OptimizedKit::VertexId> expectedVertexPath = {0, 2, 3};
+
+    for (auto queryMode: {OptimizedKit::QueryMode::PATH, OptimizedKit::QueryMode::DISTANCE_ONLY}) {
+        OptimizedKit::CchQuery query(customizer);
+        query.setQueryMode(queryMode);
+
+        // Act
+        query.run(0, 3);
+
+        // Assert
+        ASSERT_EQ(query.getQueryWeight(), 2);
+        ASSERT_EQ(query.getSecondaryTotals(), expectedTotals);
+        ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+        ASSERT_EQ(query.getVertexPath(), expectedVertexPath);
+    }
+}
+
+TEST_F(CchQueryModeTest, GetSecondaryTotals_AfterPartialUpdate_SameTotalsAsUnpackedPath) {
+    // Arrange
+    std::vector<unsigned> lengths = {7, 30, 4, 9, 12, 25, 3, 40, 6, 8};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.setSecondaryAttributes({lengths}).perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    query.setQueryMode(OptimizedKit::QueryMode::DISTANCE_ONLY);
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{6, 5}};
+
+    // Act
+    customizer.applyWeightDeltas(deltas);
+    query.run(0, 5);
+
+    // Assert
+    unsigned expectedLength = 0;
+    for (auto edge: query.getEdgePath())
+        expectedLength += lengths[edge];
+    ASSERT_EQ(query.getQueryWeight(), 6);
+    ASSERT_EQ(query.getSecondaryTotals(), std::vector<unsigned>{expectedLength});
+}
+
+TEST_F(CchQueryModeTest, Query_WithLexicographicWeights_ReturnsShortestOfEquallyFastPaths) {
+    // Arrange
+    weights[1] = 2;
+    std::vector<unsigned> lengths = {10, 5, 10, 10, 10, 10, 10, 10, 10, 10};
+    std::vector<OptimizedKit::LexicographicWeight> timeAndLength;
+    for (std::size_t edge = 0; edge < weights.size(); ++edge)
+        timeAndLength.emplace_back(weights[edge], lengths[edge]);
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, timeAndLength);
+    customizer.perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {1, 4, 6, 9};
+    std::vector<std::pair<OptimizedKit::EdgeId, OptimizedKit::LexicographicWeight>> deltas = {{1, {2, 30}}};
+
+    // Act
+    query.run(0, 5);
+    auto edgePath = query.getEdgePath();
+    auto queryWeight = query.getQueryWeight();
+    customizer.applyWeightDeltas(deltas);
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(queryWeight, OptimizedKit::LexicographicWeight(5, 35));
+    ASSERT_EQ(edgePath, expectedEdgePath);
+    ASSERT_EQ(query.getQueryWeight(), OptimizedKit::LexicographicWeight(5, 50));
+}
+
+TEST_F(CchQueryModeTest, Query_With16BitWeights_SameQueryResultAs32BitWeights) {
+    // Arrange
+    std::vector<std::uint16_t> narrowWeights(weights.begin(), weights.end());
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchCustomizer narrowCustomizer(preprocessor, narrowWeights);
+    narrowCustomizer.perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    OptimizedKit::CchQuery narrowQuery(narrowCustomizer);
+
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            // Act
+            query.run(source, target);
+            narrowQuery.run(source, target);
+
+            // Assert
+            if (query.getQueryWeight() == OptimizedKit::INFINITY_WEIGHT<unsigned>)
+                ASSERT_EQ(narrowQuery.getQueryWeight(), OptimizedKit::INFINITY_WEIGHT<std::uint16_t>);
+            else
+                ASSERT_EQ(narrowQuery.getQueryWeight(), query.getQueryWeight());
+            ASSERT_EQ(narrowQuery.getEdgePath(), query.getEdgePath());
+        }
+    }
+}
+
+TEST_F(CchQueryModeTest, Query_WithQuantizedMetric_SameQueryResultAsCustomizer) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    std::vector<unsigned> wideWeights = weights;
+    wideWeights[2] = 200000;
+    wideWeights[7] = 100000;
+    OptimizedKit::CchCustomizer customizer(preprocessor, wideWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    OptimizedKit::CchQuantizedMetric quantizedMetric(customizer);
+    OptimizedKit::CchQuery quantizedQuery(quantizedMetric);
+    std::vector<unsigned> expectedWeights;
+    std::vector<std::vector<OptimizedKit::EdgeId>> expectedEdgePaths;
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            query.run(source, target);
+            expectedWeights.push_back(query.getQueryWeight());
+            expectedEdgePaths.push_back(query.getEdgePath());
+        }
+    }
+
+    // Act
+    customizer.reset(weights).baseCustomization();
+    std::vector<unsigned> quantizedWeights;
+    std::vector<std::vector<OptimizedKit::EdgeId>> quantizedEdgePaths;
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            quantizedQuery.run(source, target);
+            quantizedWeights.push_back(quantizedQuery.getQueryWeight());
+            quantizedEdgePaths.push_back(quantizedQuery.getEdgePath());
+        }
+    }
+
+    // Assert
+    ASSERT_GT(quantizedMetric.outlierCount(), 0);
+    ASSERT_EQ(quantizedMetric.forwardWeights.offsets.size(), preprocessor.cchEdgeCount());
+    ASSERT_EQ(quantizedWeights, expectedWeights);
+    ASSERT_EQ(quantizedEdgePaths, expectedEdgePaths);
+}
+
+TEST_F(CchQueryModeTest, MemoryUsage_QuantizedMetricWithQuery_SmallerThanUnquantizedMetric) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    OptimizedKit::CchQuantizedMetric quantizedMetric(customizer);
+    OptimizedKit::CchQuery quantizedQuery(quantizedMetric);
+    auto snapshotBytes = quantizedMetric.memoryUsage().totalBytes();
+
+    // Act
+    query.run(0, 5);
+    quantizedQuery.run(0, 5);
+
+    // Assert, the snapshot is searched in place and neither it nor its query keep a decoded graph.
+    auto unquantizedBytes = customizer.memoryUsage().bytesOf("forwardWeights") +
+                            customizer.memoryUsage().bytesOf("backwardWeights") +
+                            customizer.getQueryGraph()->memoryUsage().totalBytes() + query.memoryUsage().totalBytes();
+    ASSERT_EQ(quantizedQuery.getQueryWeight(), query.getQueryWeight());
+    ASSERT_EQ(quantizedQuery.getEdgePath(), query.getEdgePath());
+    ASSERT_EQ(quantizedMetric.memoryUsage().totalBytes(), snapshotBytes);
+    ASSERT_EQ(quantizedQuery.memoryUsage().bytesOf("privateQueryGraph.arcs"), 0);
+    ASSERT_LT(snapshotBytes + quantizedQuery.memoryUsage().totalBytes(), unquantizedBytes);
+}
+
+TEST_F(CchQueryModeTest, Query_OnServingIndex_SameQueryResultAsCustomizer) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<unsigned> expectedWeights;
+    std::vector<std::vector<OptimizedKit::EdgeId>> expectedEdgePaths;
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            query.run(source, target);
+            expectedWeights.push_back(query.getQueryWeight());
+            expectedEdgePaths.push_back(query.getEdgePath());
+        }
+    }
+
+    // Act
+    OptimizedKit::CchServingIndex index(std::move(preprocessor), std::move(customizer));
+    OptimizedKit::CchQuery servingQuery(index);
+    std::vector<unsigned> servingWeights;
+    std::vector<std::vector<OptimizedKit::EdgeId>> servingEdgePaths;
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            servingQuery.run(source, target);
+            servingWeights.push_back(servingQuery.getQueryWeight());
+            servingEdgePaths.push_back(servingQuery.getEdgePath());
+        }
+    }
+    auto usage = index.memoryUsage();
+
+    // Assert
+    ASSERT_EQ(servingWeights, expectedWeights);
+    ASSERT_EQ(servingEdgePaths, expectedEdgePaths);
+    ASSERT_TRUE(index.getPreprocessor().inputGraph.tail.empty());
+    ASSERT_TRUE(index.getPreprocessor().forwardGatherInputEdge.empty());
+    ASSERT_TRUE(index.getCustomizer().perfectForwardWeights.empty());
+    ASSERT_EQ(usage.bytesOf("inputWeights"), weights.size() * sizeof(unsigned));
+    ASSERT_EQ(usage.bytesOf("upwardsGraph.head"), index.getPreprocessor().cchEdgeCount() * sizeof(OptimizedKit::VertexId));
+    ASSERT_EQ(servingQuery.biDirectionalDijkstra.queryGraph, index.getCustomizer().getQueryGraph());
+    ASSERT_GT(usage.bytesOf("queryGraph.arcs"), 0);
+    ASSERT_EQ(usage.bytesOf("queryGraph.arcs"), index.getCustomizer().getQueryGraph()->memoryUsage().bytesOf("arcs"));
+}
+
+TEST_F(CchQueryModeTest, Query_OnServingReplicas_SameQueryResultAsIndex) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchServingIndex index(std::move(preprocessor), std::move(customizer));
+    auto cpus = OptimizedKit::numaNodeCpus().front();
+
+    // Act
+    OptimizedKit::CchServingReplicas replicas(index, {cpus, cpus}, OptimizedKit::HugePagePolicy::TRANSPARENT);
+
+    // Assert
+    ASSERT_EQ(replicas.replicaCount(), 2);
+    OptimizedKit::CchQuery query(index);
+    for (std::size_t r = 0; r < replicas.replicaCount(); ++r) {
+        std::thread([&] {
+            const auto &replica = replicas.bindCurrentThread(r);
+            ASSERT_NE(&replica.getPreprocessor(), &index.getPreprocessor());
+            ASSERT_EQ(replica.getCustomizer().cchPreprocessor, &replica.getPreprocessor());
+            ASSERT_NE(replica.getCustomizer().getQueryGraph(), index.getCustomizer().getQueryGraph());
+            OptimizedKit::CchQuery replicaQuery(replica);
+            replicaQuery.setHugePagePolicy(OptimizedKit::HugePagePolicy::TRANSPARENT);
+            for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+                for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+                    query.run(source, target);
+                    replicaQuery.run(source, target);
+                    ASSERT_EQ(replicaQuery.getQueryWeight(), query.getQueryWeight());
+                    ASSERT_EQ(replicaQuery.getEdgePath(), query.getEdgePath());
+                }
+            }
+        }).join();
+    }
+}
+
+TEST_F(CchQueryModeTest, Query_OnCompressedTopology_SameQueryResultAsUncompressed) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    OptimizedKit::CchPreprocessor compressedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer compressedCustomizer(compressedPreprocessor, weights);
+    compressedCustomizer.perfectCustomization();
+    OptimizedKit::CchQuery compressedQuery(compressedCustomizer);
+
+    // Act
+    compressedPreprocessor.compressTopology();
+
+    // Assert
+    ASSERT_TRUE(compressedPreprocessor.upwardsGraph.head.empty());
+    ASSERT_TRUE(compressedPreprocessor.downwardsGraph.head.empty());
+    ASSERT_EQ(compressedPreprocessor.cchEdgeCount(), preprocessor.cchEdgeCount());
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            query.run(source, target);
+            compressedQuery.run(source, target);
+            ASSERT_EQ(compressedQuery.getQueryWeight(), query.getQueryWeight());
+            ASSERT_EQ(compressedQuery.getEdgePath(), query.getEdgePath());
+        }
+    }
+}
+
+TEST_F(CchQueryModeTest, MemoryUsage_CustomizedQuery_ReportsMemberArraysAndPhases) {
+    // Arrange
+    OptimizedKit::MemoryPhaseRecording recording;
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+
+    // Act
+    query.run(0, 5);
+    auto preprocessorUsage = preprocessor.memoryUsage();
+    auto customizerUsage = customizer.memoryUsage();
+    auto queryUsage = query.memoryUsage();
+    auto phases = recording.phases();
+
+    // Assert
+    ASSERT_EQ(preprocessorUsage.bytesOf("upwardsGraph.head"), preprocessor.upwardsGraph.head.capacity() * sizeof(OptimizedKit::VertexId));
+    ASSERT_EQ(preprocessorUsage.bytesOf("inputGraph.tail"), preprocessor.inputGraph.tail.capacity() * sizeof(OptimizedKit::VertexId));
+    ASSERT_EQ(customizerUsage.bytesOf("forwardWeights"), preprocessor.cchEdgeCount() * sizeof(unsigned));
+    ASSERT_GE(customizerUsage.bytesOf("queryGraph.arcs"),
+              preprocessor.cchEdgeCount() * sizeof(OptimizedKit::CchQueryArc<unsigned>));
+    ASSERT_EQ(queryUsage.bytesOf("privateQueryGraph.arcs"), 0);
+    ASSERT_GE(queryUsage.bytesOf("biDirectionalDijkstra.forwardDistance"), graph.vertexCount * sizeof(unsigned));
+    ASSERT_GT(preprocessorUsage.totalBytes(), 0);
+    ASSERT_EQ(phases.size(), 9);
+    ASSERT_EQ(phases.front().name, "applyOrder");
+    ASSERT_EQ(phases.back().name, "buildMetricExtractionPlan");
+}
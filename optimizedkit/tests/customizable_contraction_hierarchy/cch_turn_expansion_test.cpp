@@ -0,0 +1,147 @@
+#include <gtest/gtest.h>
+#include <numeric>
+#include "graph/graph.hpp"
+#include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
+#include "customizable_contraction_hierarchy/cch_turn_expansion.hpp"
+#include "customizable_contraction_hierarchy/cch_turn_query.hpp"
+
+class CchTurnExpansionTest : public ::testing::Test {
+protected:
+    OptimizedKit::Graph graph;
+    std::vector<unsigned> weights;
+    std::vector<OptimizedKit::VertexId> order;
+
+    void addEdge(OptimizedKit::VertexId x, OptimizedKit::VertexId y, unsigned weight) {
+        graph.addEdge(x, y);
+        weights.push_back(weight);
+    }
+
+    // The direct way 0->1->3 needs the turn from edge 0 into edge 1 at vertex 1, the detour 1->2->4->3 avoids it. Edge
+    // 5 leads back from 3 to 1.
+    void SetUp() override {
+        addEdge(0, 1, 1);
+        addEdge(1, 3, 1);
+        addEdge(1, 2, 1);
+        addEdge(2, 4, 1);
+        addEdge(4, 3, 1);
+        addEdge(3, 1, 1);
+        graph.vertexCount = 5;
+        order = {0, 2, 4, 3, 1};
+    }
+};
+
+TEST_F(CchTurnExpansionTest, Expand_WithRestrictedTurn_OmitsTurnFromTurnGraph) {
+    // Arrange
+    std::vector<OptimizedKit::Turn> restrictedTurns = {{0, 1}};
+
+    // Act
+    OptimizedKit::CchTurnExpansion expansion(graph, restrictedTurns, {{5, 2}});
+
+    // Assert, turns at vertex 1 from edges 0 and 5 into edges 1 and 2, one at 2, two at 3 and one at 4.
+    ASSERT_EQ(expansion.turnGraph.vertexCount, 6);
+    ASSERT_EQ(expansion.turnCount(), 7);
+    for (OptimizedKit::EdgeId turn = 0; turn < expansion.turnCount(); ++turn) {
+        auto from = expansion.turnGraph.tail[turn], to = expansion.turnGraph.head[turn];
+        ASSERT_EQ(graph.head[from], graph.tail[to]);
+        ASSERT_FALSE(from == 0 && to == 1);
+        ASSERT_EQ(expansion.costOfTurn[turn], from == 5 && to == 2 ? 0 : OptimizedKit::INVALID_VALUE<OptimizedKit::EdgeId>);
+    }
+
+    // Edges at vertex 1, contracted last, come last.
+    auto turnOrder = expansion.expandOrder(order);
+    ASSERT_EQ(std::vector<OptimizedKit::VertexId>(turnOrder.end() - 4, turnOrder.end()),
+              std::vector<OptimizedKit::VertexId>({0, 2, 1, 5}));
+}
+
+TEST_F(CchTurnExpansionTest, Query_WithRestrictedTurn_TakesDetour) {
+    // Arrange
+    OptimizedKit::CchTurnExpansion expansion(graph, {{0, 1}});
+    auto turnWeights = expansion.expandWeights(weights);
+    OptimizedKit::CchPreprocessor preprocessor(expansion.expandOrder(order), expansion.turnGraph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, turnWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchTurnQuery query(expansion, customizer, weights);
+
+    // Act
+    query.run(0, 3);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 4);
+    ASSERT_EQ(query.getEdgePath(), std::vector<OptimizedKit::EdgeId>({0, 2, 3, 4}));
+    ASSERT_EQ(query.getVertexPath(), std::vector<OptimizedKit::VertexId>({0, 1, 2, 4, 3}));
+    ASSERT_EQ(query.run(1, 3).getQueryWeight(), 1);
+    ASSERT_EQ(query.run(3, 0).getQueryWeight(), OptimizedKit::INFINITY_WEIGHT<unsigned>);
+}
+
+TEST_F(CchTurnExpansionTest, Query_AfterTurnCostChange_OnlyNeedsCustomization) {
+    // Arrange
+    OptimizedKit::CchTurnExpansion expansion(graph, {}, {{0, 1}});
+    auto turnWeights = expansion.expandWeights(weights, {5u});
+    OptimizedKit::CchPreprocessor preprocessor(expansion.expandOrder(order), expansion.turnGraph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, turnWeights);
+    customizer.baseCustomization();
+    auto expensiveTurnWeight = OptimizedKit::CchTurnQuery(expansion, customizer, weights).run(0, 3).getQueryWeight();
+
+    // Act
+    turnWeights = expansion.expandWeights(weights, {1u});
+    customizer.reset(turnWeights).baseCustomization();
+    OptimizedKit::CchTurnQuery query(expansion, customizer, weights);
+    query.run(0, 3);
+
+    // Assert
+    ASSERT_EQ(expensiveTurnWeight, 4);
+    ASSERT_EQ(query.getQueryWeight(), 3);
+    ASSERT_EQ(query.getEdgePath(), std::vector<OptimizedKit::EdgeId>({0, 1}));
+}
+
+TEST_F(CchTurnExpansionTest, Query_WithoutTurnCosts_SameQueryResultAsCchOnInputGraph) {
+    // Arrange, a 4x4 grid with edges in both directions.
+    OptimizedKit::Graph grid;
+    std::vector<unsigned> gridWeights;
+    for (OptimizedKit::VertexId x = 0; x < 16; ++x) {
+        for (auto y: {x + 1, x + 4}) {
+            if ((y == x + 1 && x % 4 == 3) || y >= 16)
+                continue;
+            grid.addEdge(x, y);
+            gridWeights.push_back(1 + (x * 7 + y) % 5);
+            grid.addEdge(y, x);
+            gridWeights.push_back(1 + (x * 3 + y) % 4);
+        }
+    }
+    grid.vertexCount = 16;
+    std::vector<OptimizedKit::VertexId> gridOrder(16);
+    std::iota(gridOrder.begin(), gridOrder.end(), 0);
+    OptimizedKit::CchPreprocessor preprocessor(gridOrder, grid);
+    OptimizedKit::CchCustomizer customizer(preprocessor, gridWeights);
+    customizer.baseCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    OptimizedKit::CchTurnExpansion expansion(grid, {});
+    auto turnWeights = expansion.expandWeights(gridWeights);
+    OptimizedKit::CchPreprocessor turnPreprocessor(expansion.expandOrder(gridOrder), expansion.turnGraph);
+    OptimizedKit::CchCustomizer turnCustomizer(turnPreprocessor, turnWeights);
+    turnCustomizer.baseCustomization();
+    OptimizedKit::CchTurnQuery turnQuery(expansion, turnCustomizer, gridWeights);
+
+    // Act & Assert
+    for (OptimizedKit::VertexId source = 0; source < 16; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < 16; ++target) {
+            query.run(source, target);
+            turnQuery.run(source, target);
+            ASSERT_EQ(turnQuery.getQueryWeight(), query.getQueryWeight()) << source << " -> " << target;
+
+            // The path is connected, leads from source to target and has the query weight.
+            auto edgePath = turnQuery.getEdgePath();
+            auto vertexPath = turnQuery.getVertexPath();
+            unsigned pathWeight = 0;
+            for (std::size_t i = 0; i < edgePath.size(); ++i) {
+                ASSERT_EQ(grid.tail[edgePath[i]], vertexPath[i]);
+                pathWeight += gridWeights[edgePath[i]];
+            }
+            ASSERT_EQ(vertexPath.front(), source);
+            ASSERT_EQ(vertexPath.back(), target);
+            ASSERT_EQ(pathWeight, turnQuery.getQueryWeight());
+        }
+    }
+}
@@ -0,0 +1,366 @@
+#include <gtest/gtest.h>
+#include <limits>
+#include "graph/graph.hpp"
+#include "customizable_contraction_hierarchy/cch_preprocessor.hpp"
+#include "customizable_contraction_hierarchy/cch_customizer.hpp"
+#include "customizable_contraction_hierarchy/cch_query.hpp"
+#include "../test_utils/small_graph_fixture.hpp"
+
+class CchUpdateTest : public SmallGraphTest {
+};
+
+TEST_F(CchUpdateTest, ApplyWeightDeltas_WithDuplicateDeltas_CustomizeAsBaseCustomization) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{3, 7}, {6, 42}, {1, 42}, {3, 42}};
+    auto expectedWeights = weights;
+    for (auto [edge, weight]: deltas)
+        expectedWeights[edge] = weight;
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, expectedWeights);
+    expectedCustomizer.baseCustomization();
+
+    // Act
+    customizer.applyWeightDeltas(deltas);
+
+    // Assert
+    ASSERT_EQ(customizer.forwardWeights, expectedCustomizer.forwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedCustomizer.backwardWeights);
+    ASSERT_EQ(customizer.updateStatistics.numInputEdgesUpdated, deltas.size());
+    ASSERT_GE(customizer.updateStatistics.numCchEdgesProcessed, customizer.updateStatistics.numCchEdgesChanged);
+}
+
+TEST_F(CchUpdateTest, ApplyWeightDeltas_WithCallerWeights_CallerWeightsUnchanged) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    auto originalWeights = weights;
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{0, 9}, {9, 9}};
+
+    // Act
+    customizer.applyWeightDeltas(deltas);
+    customizer.applyWeightDeltas(deltas);
+
+    // Assert
+    ASSERT_EQ(weights, originalWeights);
+    ASSERT_EQ(customizer.getStagedInputWeights()[0], 9);
+    ASSERT_EQ(customizer.getStagedInputWeights()[9], 9);
+    ASSERT_EQ(customizer.updateStatistics.numInputEdgesUpdated, 0);
+    ASSERT_EQ(customizer.updateStatistics.numCchEdgesProcessed, 0);
+}
+
+TEST_F(CchUpdateTest, Update_AfterWeightDeltas_CustomizesFromCallerWeights) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{3, 7}, {6, 42}};
+    customizer.applyWeightDeltas(deltas);
+    weights[6] = 2;
+    auto expectedWeights = weights;
+    expectedWeights[3] = 7;
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, expectedWeights);
+    expectedCustomizer.baseCustomization();
+
+    // Act
+    customizer.update({6});
+
+    // Assert
+    ASSERT_EQ(customizer.getStagedInputWeights(), expectedWeights);
+    ASSERT_EQ(customizer.forwardWeights, expectedCustomizer.forwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedCustomizer.backwardWeights);
+}
+
+TEST_F(CchUpdateTest, EliminationTreeLevels_AnyUpwardsEdge_HeadOnHigherLevelThanTail) {
+    // Arrange & Act
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+
+    // Assert
+    ASSERT_EQ(preprocessor.eliminationTreeLevel.size(), preprocessor.cchVertexCount());
+    for (OptimizedKit::EdgeId edge = 0; edge < preprocessor.cchEdgeCount(); ++edge) {
+        auto tailLevel = preprocessor.eliminationTreeLevel[preprocessor.upwardsGraph.tail[edge]];
+        auto headLevel = preprocessor.eliminationTreeLevel[preprocessor.upwardsGraph.head[edge]];
+        EXPECT_LT(tailLevel, headLevel) << "Levels of edge " << edge << " are not increasing";
+        EXPECT_LT(headLevel, preprocessor.eliminationTreeLevelCount);
+    }
+}
+
+TEST_F(CchUpdateTest, UpdateInParallel_WithPartialUpdate_CustomizeAsSequentialUpdate) {
+    // Arrange
+    OptimizedKit::CchPreprocessor sequentialPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer sequentialCustomizer(sequentialPreprocessor, weights);
+    sequentialCustomizer.baseCustomization();
+    OptimizedKit::CchPreprocessor parallelPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer parallelCustomizer(parallelPreprocessor, weights);
+    parallelCustomizer.baseCustomization();
+    parallelCustomizer.setUpdateMode(OptimizedKit::UpdateMode::PARALLEL, 4);
+    std::vector<OptimizedKit::EdgeId> updateArcIds = {3, 6, 1, 9};
+    for (auto arc: updateArcIds)
+        weights[arc] = 42;
+
+    // Act
+    sequentialCustomizer.update(updateArcIds);
+    parallelCustomizer.update(updateArcIds);
+
+    // Assert
+    ASSERT_EQ(parallelCustomizer.forwardWeights, sequentialCustomizer.forwardWeights);
+    ASSERT_EQ(parallelCustomizer.backwardWeights, sequentialCustomizer.backwardWeights);
+    ASSERT_EQ(parallelCustomizer.updateStatistics.numCchEdgesProcessed,
+              sequentialCustomizer.updateStatistics.numCchEdgesProcessed);
+}
+
+TEST_F(CchUpdateTest, Update_PastBreakEven_FallsBackToFullCustomization) {
+    // Arrange, a first update measures the cost of partial updates.
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    weights[3] = 7;
+    customizer.update({3});
+    customizer.setFullCustomizationBreakEven(0);
+    std::vector<OptimizedKit::EdgeId> updateArcIds = {6, 1, 9};
+    for (auto arc: updateArcIds)
+        weights[arc] = 42;
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, weights);
+    expectedCustomizer.baseCustomization();
+
+    // Act
+    customizer.update(updateArcIds);
+
+    // Assert
+    ASSERT_FALSE(customizer.updateNanosPerProcessedEdge == 0);
+    ASSERT_TRUE(customizer.updateStatistics.usedFullCustomization);
+    ASSERT_EQ(customizer.updateStatistics.numCchEdgesProcessed, preprocessor.cchEdgeCount());
+    ASSERT_EQ(customizer.forwardWeights, expectedCustomizer.forwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedCustomizer.backwardWeights);
+}
+
+TEST_F(CchUpdateTest, UpdateInParallel_WithDisabledBreakEven_NeverFallsBack) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    customizer.setUpdateMode(OptimizedKit::UpdateMode::PARALLEL, 4)
+              .setFullCustomizationBreakEven(std::numeric_limits<double>::infinity());
+    std::vector<std::vector<OptimizedKit::EdgeId>> updateBatches = {{3}, {6, 1, 9}, {0, 2, 4, 5, 7, 8}};
+
+    // Act & Assert, the worker threads are reused by every update.
+    for (const auto &batch: updateBatches) {
+        for (auto arc: batch)
+            weights[arc] += 5;
+        customizer.update(batch);
+        ASSERT_FALSE(customizer.updateStatistics.usedFullCustomization);
+    }
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, weights);
+    expectedCustomizer.baseCustomization();
+    ASSERT_EQ(customizer.forwardWeights, expectedCustomizer.forwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedCustomizer.backwardWeights);
+}
+
+TEST_F(CchUpdateTest, ApplyWeightDeltas_AfterPerfectCustomization_CustomizeAsPerfectCustomization) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{3, 1}, {7, 1}, {1, 9}, {9, 5}};
+    auto expectedWeights = weights;
+    for (auto [edge, weight]: deltas)
+        expectedWeights[edge] = weight;
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, expectedWeights);
+    expectedCustomizer.perfectCustomization();
+
+    // Act
+    customizer.applyWeightDeltas(deltas);
+
+    // Assert
+    ASSERT_EQ(customizer.perfectForwardWeights, expectedCustomizer.perfectForwardWeights);
+    ASSERT_EQ(customizer.perfectBackwardWeights, expectedCustomizer.perfectBackwardWeights);
+    ASSERT_EQ(customizer.getQueryGraph()->arcs, expectedCustomizer.getQueryGraph()->arcs);
+    ASSERT_EQ(customizer.perfectEdgeCount(), expectedCustomizer.perfectEdgeCount());
+}
+
+TEST_F(CchUpdateTest, PerfectCustomize_WithMockGraph_QueryGraphLeavesOutPrunedArcs) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer baseCustomizer(preprocessor, weights);
+    baseCustomizer.baseCustomization();
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+
+    // Act
+    customizer.perfectCustomization();
+    OptimizedKit::CchQuery baseQuery(baseCustomizer);
+    OptimizedKit::CchQuery query(customizer);
+
+    // Assert, queries only scan the arcs left by the perfect customization and still find every shortest path.
+    ASSERT_EQ(customizer.getQueryGraph()->arcCount(), customizer.perfectEdgeCount());
+    ASSERT_LT(customizer.getQueryGraph()->arcCount(), preprocessor.cchEdgeCount());
+    for (OptimizedKit::VertexId source = 0; source < graph.vertexCount; ++source) {
+        for (OptimizedKit::VertexId target = 0; target < graph.vertexCount; ++target) {
+            auto weight = query.run(source, target).getQueryWeight();
+            ASSERT_EQ(weight, baseQuery.run(source, target).getQueryWeight()) << source << " -> " << target;
+            if (weight == OptimizedKit::INFINITY_WEIGHT<unsigned>)
+                continue;
+            auto vertexPath = query.getVertexPath();
+            ASSERT_EQ(vertexPath.front(), source);
+            ASSERT_EQ(vertexPath.back(), target);
+        }
+    }
+}
+
+TEST(CchMetricExtractionTest, BaseCustomize_WithParallelInputEdges_GathersMinimumWeight) {
+    // Arrange
+    OptimizedKit::Graph graph;
+    graph.addEdge(0, 1);
+    graph.addEdge(0, 1);
+    graph.addEdge(1, 0);
+    graph.addEdge(1, 2);
+    graph.vertexCount = 3;
+    std::vector<unsigned> weights = {5, 2, 7, 3};
+    std::vector<OptimizedKit::VertexId> order = {0, 1, 2};
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+
+    // Act
+    customizer.baseCustomization();
+
+    // Assert
+    ASSERT_EQ(preprocessor.forwardReductionCchEdge.size(), 1);
+    ASSERT_TRUE(preprocessor.backwardReductionCchEdge.empty());
+    ASSERT_EQ(customizer.forwardWeights, std::vector<unsigned>({2, 3}));
+    ASSERT_EQ(customizer.backwardWeights, std::vector<unsigned>({7, OptimizedKit::INFINITY_WEIGHT<unsigned>}));
+}
+
+TEST_F(CchUpdateTest, Query_AfterBlockingUpdate_ReturnsUnreachable) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{4, OptimizedKit::INFINITY_WEIGHT<unsigned>},
+                                                                    {5, OptimizedKit::INFINITY_WEIGHT<unsigned>}};
+    customizer.applyWeightDeltas(deltas);
+    OptimizedKit::CchQuery query(customizer);
+
+    // Act
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_FALSE(customizer.mayReach(preprocessor.rank[0], preprocessor.rank[5]));
+    ASSERT_EQ(query.getQueryWeight(), OptimizedKit::INFINITY_WEIGHT<unsigned>);
+    ASSERT_EQ(query.biDirectionalDijkstra.numVerticesExplored, 0);
+}
+
+TEST_F(CchUpdateTest, ApplyWeightDeltas_AfterUnblockingUpdate_ReachableAgain) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> blockingDeltas = {{4, OptimizedKit::INFINITY_WEIGHT<unsigned>},
+                                                                            {5, OptimizedKit::INFINITY_WEIGHT<unsigned>}};
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> unblockingDeltas = {{4, weights[4]}, {5, weights[5]}};
+    customizer.applyWeightDeltas(blockingDeltas);
+
+    // Act
+    customizer.applyWeightDeltas(unblockingDeltas);
+
+    // Assert
+    ASSERT_EQ(customizer.stronglyConnectedComponent, preprocessor.stronglyConnectedComponent);
+    ASSERT_EQ(customizer.weaklyConnectedComponent, preprocessor.weaklyConnectedComponent);
+    ASSERT_TRUE(customizer.mayReach(preprocessor.rank[0], preprocessor.rank[5]));
+}
+
+TEST_F(CchUpdateTest, Query_WithBlockedEdgeOnPath_AvoidsEdgeWithoutUpdatingCustomizer) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    auto expectedForwardWeights = customizer.forwardWeights;
+    auto expectedBackwardWeights = customizer.backwardWeights;
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {1, 4, 6, 9};
+
+    // Act
+    query.setBlockedEdges({3});
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 6);
+    ASSERT_EQ(query.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(customizer.forwardWeights, expectedForwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedBackwardWeights);
+    ASSERT_EQ(query.setBlockedEdges({}).run(0, 5).getQueryWeight(), 5);
+}
+
+TEST_F(CchUpdateTest, Query_WithBlockedEdgeAfterPerfectCustomization_AvoidsEdge) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchQuery query(customizer);
+    std::vector<OptimizedKit::VertexId> expectedVertexPath = {0, 2, 3, 4, 5};
+
+    // Act
+    query.setBlockedEdges({3, 0});
+    query.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(query.getQueryWeight(), 6);
+    ASSERT_EQ(query.getVertexPath(), expectedVertexPath);
+}
+
+TEST_F(CchUpdateTest, MetricOverlay_ApplyWeightDeltas_MatchesFreshCustomizationWithoutUpdatingCustomizer) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.baseCustomization();
+    auto expectedForwardWeights = customizer.forwardWeights;
+    auto expectedBackwardWeights = customizer.backwardWeights;
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{3, 7}, {6, 42}, {1, 1}};
+    auto personalizedWeights = weights;
+    for (auto [edge, weight]: deltas)
+        personalizedWeights[edge] = weight;
+    OptimizedKit::CchPreprocessor expectedPreprocessor(order, graph);
+    OptimizedKit::CchCustomizer expectedCustomizer(expectedPreprocessor, personalizedWeights);
+    expectedCustomizer.baseCustomization();
+    OptimizedKit::CchMetricOverlay overlay(customizer);
+
+    // Act
+    overlay.applyWeightDeltas(deltas);
+
+    // Assert
+    for (OptimizedKit::EdgeId edge = 0; edge < preprocessor.cchEdgeCount(); ++edge) {
+        ASSERT_EQ(overlay.forwardWeight(edge), expectedCustomizer.forwardWeights[edge]);
+        ASSERT_EQ(overlay.backwardWeight(edge), expectedCustomizer.backwardWeights[edge]);
+    }
+    ASSERT_LT(overlay.changedEdgeCount(), preprocessor.cchEdgeCount());
+    ASSERT_EQ(customizer.forwardWeights, expectedForwardWeights);
+    ASSERT_EQ(customizer.backwardWeights, expectedBackwardWeights);
+}
+
+TEST_F(CchUpdateTest, Query_WithMetricOverlay_UsesPersonalizedWeights) {
+    // Arrange
+    OptimizedKit::CchPreprocessor preprocessor(order, graph);
+    OptimizedKit::CchCustomizer customizer(preprocessor, weights);
+    customizer.perfectCustomization();
+    OptimizedKit::CchMetricOverlay overlay(customizer);
+    std::vector<std::pair<OptimizedKit::EdgeId, unsigned>> deltas = {{3, 42}};
+    overlay.applyWeightDeltas(deltas);
+    OptimizedKit::CchQuery personalizedQuery(overlay);
+    OptimizedKit::CchQuery sharedQuery(customizer);
+    std::vector<OptimizedKit::EdgeId> expectedEdgePath = {1, 4, 6, 9};
+
+    // Act
+    personalizedQuery.run(0, 5);
+    sharedQuery.run(0, 5);
+
+    // Assert
+    ASSERT_EQ(personalizedQuery.getQueryWeight(), 6);
+    ASSERT_EQ(personalizedQuery.getEdgePath(), expectedEdgePath);
+    ASSERT_EQ(sharedQuery.getQueryWeight(), 5);
+    ASSERT_EQ(personalizedQuery.setMetricOverlay(nullptr).run(0, 5).getQueryWeight(), 5);
+}
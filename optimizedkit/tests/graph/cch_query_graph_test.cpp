@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include "graph/cch_query_graph.hpp"
+
+class CchQueryGraphTest : public ::testing::Test {
+protected:
+    OptimizedKit::Graph upwardsGraph;
+    std::vector<unsigned> forwardWeights;
+    std::vector<unsigned> backwardWeights;
+
+    void SetUp() override {
+        upwardsGraph.tail = std::vector<OptimizedKit::VertexId>({0, 0, 1, 1, 2, 3, 3, 4, 4, 5});
+        upwardsGraph.head = std::vector<OptimizedKit::VertexId>({1, 5, 5, 6, 4, 4, 5, 5, 6, 6});
+        upwardsGraph.adjacencyIndices = {0, 2, 4, 5, 7, 9, 10, 10};
+        forwardWeights = {1, 3, 5, 10, 2, 4, 0, 7, 9, 6};
+        backwardWeights = {2, 4, 6, 11, 7, 8, 2, 1, 0, 5};
+    }
+};
+
+TEST_F(CchQueryGraphTest, Build_WithUpwardsGraph_PacksArcsOfEveryVertex) {
+    // Arrange
+    OptimizedKit::CchGraph<unsigned> cchGraph(&upwardsGraph, &forwardWeights, &backwardWeights, 7);
+
+    // Act
+    OptimizedKit::CchQueryGraph<unsigned> queryGraph(cchGraph);
+
+    // Assert
+    for (OptimizedKit::VertexId x = 0; x < 7; ++x) {
+        const auto &range = queryGraph.arcsOf(x);
+        ASSERT_EQ(range.end - range.begin, upwardsGraph.adjacencyIndices[x + 1] - upwardsGraph.adjacencyIndices[x]);
+        for (auto arc = range.begin; arc < range.end; ++arc) {
+            auto edge = queryGraph.arcs[arc].cchEdge;
+            ASSERT_EQ(edge, upwardsGraph.adjacencyIndices[x] + arc - range.begin);
+            ASSERT_EQ(queryGraph.arcs[arc].head, upwardsGraph.head[edge]);
+            ASSERT_EQ(queryGraph.arcs[arc].forwardWeight, forwardWeights[edge]);
+            ASSERT_EQ(queryGraph.arcs[arc].backwardWeight, backwardWeights[edge]);
+        }
+    }
+}
+
+TEST_F(CchQueryGraphTest, BuildCompacted_WithInfiniteArcs_LeavesThemOut) {
+    // Arrange
+    const auto infinity = OptimizedKit::INFINITY_WEIGHT<unsigned>;
+    forwardWeights[1] = infinity;
+    backwardWeights[1] = infinity;
+    forwardWeights[3] = infinity;
+    forwardWeights[4] = infinity;
+    backwardWeights[4] = infinity;
+
+    // Act
+    OptimizedKit::CchQueryGraph<unsigned> queryGraph;
+    queryGraph.buildCompacted(upwardsGraph, 7, [&](OptimizedKit::EdgeId edge) {
+        return std::make_pair(forwardWeights[edge], backwardWeights[edge]);
+    });
+
+    // Assert, the arc of edge 3 keeps its finite backward direction.
+    ASSERT_EQ(queryGraph.arcCount(), 8);
+    ASSERT_EQ(queryGraph.arcsOf(0).end - queryGraph.arcsOf(0).begin, 1);
+    ASSERT_EQ(queryGraph.arcsOf(2).end - queryGraph.arcsOf(2).begin, 0);
+    ASSERT_EQ(queryGraph.findArc(0, 5), nullptr);
+    ASSERT_EQ(queryGraph.findArc(2, 4), nullptr);
+    ASSERT_NE(queryGraph.findArc(1, 6), nullptr);
+    ASSERT_EQ(queryGraph.findArc(1, 6)->cchEdge, 3);
+    ASSERT_EQ(queryGraph.findArc(1, 6)->forwardWeight, infinity);
+    ASSERT_EQ(queryGraph.findArc(1, 6)->backwardWeight, 11);
+}
+
+TEST_F(CchQueryGraphTest, Build_WithUpwardsGraph_ArcBlocksStartAtCacheLines) {
+    // Arrange
+    OptimizedKit::CchGraph<unsigned> cchGraph(&upwardsGraph, &forwardWeights, &backwardWeights, 7);
+
+    // Act
+    OptimizedKit::CchQueryGraph<unsigned> queryGraph(cchGraph);
+
+    // Assert
+    for (OptimizedKit::VertexId x = 0; x < 6; ++x) {
+        auto address = reinterpret_cast<std::uintptr_t>(queryGraph.arcs.data() + queryGraph.arcsOf(x).begin);
+        ASSERT_EQ(address % OptimizedKit::CACHE_LINE_SIZE, 0);
+    }
+}
+
+TEST_F(CchQueryGraphTest, SetHugePagePolicy_BuiltGraph_KeepsArcs) {
+    // Arrange
+    OptimizedKit::CchGraph<unsigned> cchGraph(&upwardsGraph, &forwardWeights, &backwardWeights, 7);
+    OptimizedKit::CchQueryGraph<unsigned> queryGraph(cchGraph);
+    auto arcs = std::vector<OptimizedKit::CchQueryArc<unsigned>>(queryGraph.arcs.begin(), queryGraph.arcs.end());
+
+    // Act
+    queryGraph.setHugePagePolicy(OptimizedKit::HugePagePolicy::TRANSPARENT);
+
+    // Assert
+    ASSERT_EQ(queryGraph.arcs.get_allocator().getPolicy(), OptimizedKit::HugePagePolicy::TRANSPARENT);
+    ASSERT_EQ(queryGraph.arcs.size(), arcs.size());
+    for (std::size_t arc = 0; arc < arcs.size(); ++arc) {
+        ASSERT_EQ(queryGraph.arcs[arc].head, arcs[arc].head);
+        ASSERT_EQ(queryGraph.arcs[arc].cchEdge, arcs[arc].cchEdge);
+    }
+}
@@ -0,0 +1,79 @@
+#include <gtest/gtest.h>
+#include <graph/compressed_graph.hpp>
+
+namespace {
+    OptimizedKit::Graph createSortedGraph() {
+        OptimizedKit::Graph graph;
+        graph.addEdge(0, 1);
+        graph.addEdge(0, 300);
+        graph.addEdge(0, 100000);
+        graph.addEdge(2, 0);
+        graph.addEdge(2, 1);
+        graph.addEdge(2, 1);
+        graph.addEdge(300, 2);
+        graph.vertexCount = 100001;
+        graph.createAdjacencyIndices();
+        return graph;
+    }
+}
+
+TEST(CompressedGraphTest, Adjacency_SortedGraph_DecodesHeadsAndEdgeIds) {
+    // Arrange
+    auto graph = createSortedGraph();
+
+    // Act
+    OptimizedKit::CompressedGraph compressedGraph(graph);
+
+    // Assert
+    ASSERT_EQ(compressedGraph.getEdgeCount(), graph.getEdgeCount());
+    for (OptimizedKit::VertexId x = 0; x < graph.vertexCount; ++x) {
+        auto range = compressedGraph.adjacency(x);
+        auto edge = graph.adjacencyIndices[x];
+        for (auto it = range.begin(); it != range.end(); ++it, ++edge) {
+            ASSERT_EQ(it.edge(), edge);
+            ASSERT_EQ(*it, graph.head[edge]);
+        }
+        ASSERT_EQ(edge, graph.adjacencyIndices[x + 1]);
+    }
+}
+
+TEST(CompressedGraphTest, TailOf_EdgeAfterEmptyVertices_ReturnsTail) {
+    // Arrange
+    OptimizedKit::CompressedGraph compressedGraph(createSortedGraph());
+
+    // Act
+    auto actual = compressedGraph.tailOf(6);
+
+    // Assert
+    ASSERT_EQ(actual, 300);
+    ASSERT_EQ(compressedGraph.tailOf(3), 2);
+}
+
+TEST(CompressedGraphTest, HeadOf_EveryEdge_SameHeadAsGraph) {
+    // Arrange
+    auto graph = createSortedGraph();
+
+    // Act
+    OptimizedKit::CompressedGraph compressedGraph(graph);
+
+    // Assert
+    for (OptimizedKit::EdgeId edge = 0; edge < graph.getEdgeCount(); ++edge)
+        ASSERT_EQ(compressedGraph.headOf(edge), graph.head[edge]);
+}
+
+TEST(CompressedGraphTest, MemoryUsage_SmallDeltas_OneBytePerHead) {
+    // Arrange
+    OptimizedKit::Graph graph;
+    for (OptimizedKit::VertexId x = 0; x < 100; ++x)
+        for (OptimizedKit::VertexId y = x + 1; y < x + 4; ++y)
+            graph.addEdge(x, y);
+    graph.vertexCount = 103;
+    graph.createAdjacencyIndices();
+
+    // Act
+    OptimizedKit::CompressedGraph compressedGraph(graph);
+
+    // Assert
+    ASSERT_EQ(compressedGraph.memoryUsage().bytesOf("bytes"), graph.getEdgeCount());
+    ASSERT_EQ(compressedGraph.memoryUsage().bytesOf("byteOffsets"), graph.vertexCount * sizeof(std::uint32_t));
+}
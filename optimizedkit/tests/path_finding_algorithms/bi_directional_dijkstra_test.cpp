@@ -129,3 +129,50 @@ TEST_F(BiDirectionalDijkstraTest, RunPairing_ValidThreeTwoSingleResultQuery_Retu
     // Assert
     EXPECT_EQ(biDirectionalDijkstra.shortestPathLength, expectedDistance);
 }
+
+TEST_F(BiDirectionalDijkstraTest, Run_AfterEarlierQueries_SameDistancesAsFreshSearch) {
+    // Arrange
+    OptimizedKit::CchGraph<unsigned> cchGraph(&upwardsGraph, &forwardWeights, &backwardWeights, vertexCount);
+    OptimizedKit::BiDirectionalDijkstra<unsigned> biDirectionalDijkstra(cchGraph);
+    biDirectionalDijkstra.run(1, 2);
+    biDirectionalDijkstra.queryMode = OptimizedKit::QueryMode::DISTANCE_ONLY;
+    biDirectionalDijkstra.run(3, 2);
+
+    // Act
+    biDirectionalDijkstra.queryMode = OptimizedKit::QueryMode::PATH;
+    biDirectionalDijkstra.run(1, 5);
+
+    // Assert, only the entries of the vertices reached by the last search differ from a fresh search.
+    OptimizedKit::BiDirectionalDijkstra<unsigned> freshDijkstra(cchGraph);
+    freshDijkstra.run(1, 5);
+    EXPECT_EQ(biDirectionalDijkstra.shortestPathLength, 5);
+    EXPECT_EQ(biDirectionalDijkstra.forwardDistance, freshDijkstra.forwardDistance);
+    EXPECT_EQ(biDirectionalDijkstra.backwardDistance, freshDijkstra.backwardDistance);
+    EXPECT_EQ(biDirectionalDijkstra.forwardPredecessor, freshDijkstra.forwardPredecessor);
+    EXPECT_EQ(biDirectionalDijkstra.backwardPredecessor, freshDijkstra.backwardPredecessor);
+    EXPECT_EQ(biDirectionalDijkstra.forwardSettled, freshDijkstra.forwardSettled);
+    EXPECT_EQ(biDirectionalDijkstra.backwardSettled, freshDijkstra.backwardSettled);
+}
+
+TEST_F(BiDirectionalDijkstraTest, Run_WithArcAttributes_FollowsEqualPathWithSmallestTotals) {
+    // Arrange, 0->1->3 and 0->2->3 are equally short, the arc 1->3 reached first has the larger attribute.
+    OptimizedKit::Graph diamond;
+    diamond.tail = {0, 0, 1, 2};
+    diamond.head = {1, 2, 3, 3};
+    diamond.adjacencyIndices = {0, 2, 3, 4, 4};
+    std::vector<unsigned> diamondForwardWeights = {1, 1, 1, 1};
+    std::vector<unsigned> diamondBackwardWeights(4, OptimizedKit::INFINITY_WEIGHT<unsigned>);
+    std::vector<unsigned> attributes = {0, 0, 5, 1};
+    OptimizedKit::CchGraph<unsigned> cchGraph(&diamond, &diamondForwardWeights, &diamondBackwardWeights, 4);
+    OptimizedKit::BiDirectionalDijkstra<unsigned> biDirectionalDijkstra(cchGraph);
+    biDirectionalDijkstra.setArcAttributes(1, attributes.data(), attributes.data());
+
+    // Act
+    biDirectionalDijkstra.run(0, 3);
+
+    // Assert
+    EXPECT_EQ(biDirectionalDijkstra.shortestPathLength, 2);
+    EXPECT_EQ(biDirectionalDijkstra.meetingVertex, 3);
+    EXPECT_EQ(biDirectionalDijkstra.forwardPredecessor[3], 2);
+    EXPECT_EQ(biDirectionalDijkstra.forwardAttributeTotals[3], 1);
+}
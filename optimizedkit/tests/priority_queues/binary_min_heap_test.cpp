@@ -77,6 +77,26 @@ TEST_F(BinaryMinHeapTest, Clear_HeapNotEmpty_HeapBecomesEmpty) {
     ASSERT_TRUE(heap->isEmpty());
 }
 
+TEST_F(BinaryMinHeapTest, InsertOrUpdate_AfterClear_NodesInsertedAgain) {
+    // Arrange
+    heap = new OptimizedKit::BinaryMinHeap<unsigned, unsigned>();
+    for (unsigned i = 0; i < NUM_VERTICES; i++)
+        heap->insertOrUpdate(10 + i, i);
+    heap->deleteMin();
+    heap->clear();
+
+    // Act
+    heap->insertOrUpdate(7, 3);
+    heap->insertOrUpdate(5, 0);
+    heap->insertOrUpdate(2, 3);
+
+    // Assert
+    ASSERT_EQ(heap->size(), 2);
+    ASSERT_EQ(heap->deleteMin(), 3);
+    ASSERT_EQ(heap->deleteMin(), 0);
+    ASSERT_TRUE(heap->isEmpty());
+}
+
 TEST_F(BinaryMinHeapTest, EmptyHeapOperations_HeapIsEmpty_ExceptionsThrown) {
     // Arrange
     heap = new OptimizedKit::BinaryMinHeap<unsigned, unsigned>();
@@ -0,0 +1,68 @@
+#include <gtest/gtest.h>
+#include <priority_queues/monotone_bitset_queue.hpp>
+
+TEST(MonotoneBitsetQueueTest, Insert_DuplicateIds_IdsAreMerged) {
+    // Arrange
+    OptimizedKit::MonotoneBitsetQueue queue(200);
+
+    // Act
+    auto firstInsert = queue.insert(130);
+    auto secondInsert = queue.insert(130);
+    queue.insert(7);
+
+    // Assert
+    ASSERT_TRUE(firstInsert);
+    ASSERT_FALSE(secondInsert);
+    ASSERT_EQ(queue.size(), 2);
+}
+
+TEST(MonotoneBitsetQueueTest, DeleteMin_IdsAcrossWords_ReturnsIdsInAscendingOrder) {
+    // Arrange
+    OptimizedKit::MonotoneBitsetQueue queue(300);
+    std::vector<unsigned> ids = {299, 0, 64, 63, 128, 65, 1};
+    for (auto id: ids)
+        queue.insert(id);
+    std::sort(ids.begin(), ids.end());
+
+    // Act & Assert
+    for (auto id: ids)
+        ASSERT_EQ(queue.deleteMin(), id);
+    ASSERT_TRUE(queue.isEmpty());
+}
+
+TEST(MonotoneBitsetQueueTest, Insert_HigherIdsWhileDraining_ReturnsIdsInAscendingOrder) {
+    // Arrange
+    OptimizedKit::MonotoneBitsetQueue queue(1000);
+    queue.insert(10);
+    std::vector<unsigned> extracted;
+
+    // Act
+    while (!queue.isEmpty()) {
+        auto id = queue.deleteMin();
+        extracted.push_back(id);
+        if (id * 3 < 1000)
+            queue.insert(id * 3);
+        if (id + 500 < 1000)
+            queue.insert(id + 500);
+    }
+
+    // Assert
+    std::vector<unsigned> expected = {10, 30, 90, 270, 510, 530, 590, 770, 810};
+    ASSERT_EQ(extracted, expected);
+}
+
+TEST(MonotoneBitsetQueueTest, Clear_QueueNotEmpty_QueueIsReusable) {
+    // Arrange
+    OptimizedKit::MonotoneBitsetQueue queue(100);
+    queue.insert(90);
+    queue.insert(3);
+
+    // Act
+    queue.clear();
+    queue.insert(50);
+
+    // Assert
+    ASSERT_EQ(queue.size(), 1);
+    ASSERT_EQ(queue.deleteMin(), 50);
+    ASSERT_TRUE(queue.isEmpty());
+}
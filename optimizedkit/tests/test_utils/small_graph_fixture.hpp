@@ -0,0 +1,32 @@
+#ifndef OPTIMIZEDKIT_SMALL_GRAPH_FIXTURE_HPP
+#define OPTIMIZEDKIT_SMALL_GRAPH_FIXTURE_HPP
+
+#include <gtest/gtest.h>
+#include <vector>
+#include "graph/graph.hpp"
+
+// Six vertex graph with two routes from 0 to 5 shared by the update, query mode and multi query tests.
+class SmallGraphTest : public ::testing::Test {
+protected:
+    OptimizedKit::Graph graph;
+    std::vector<unsigned> weights;
+    std::vector<OptimizedKit::VertexId> order;
+
+    void SetUp() override {
+        graph.addEdge(0, 1);
+        graph.addEdge(0, 2);
+        graph.addEdge(1, 0);
+        graph.addEdge(1, 2);
+        graph.addEdge(2, 3);
+        graph.addEdge(2, 4);
+        graph.addEdge(3, 4);
+        graph.addEdge(3, 5);
+        graph.addEdge(4, 3);
+        graph.addEdge(4, 5);
+        graph.vertexCount = 6;
+        weights = {1, 3, 3, 1, 1, 3, 1, 4, 1, 1};
+        order = {1, 0, 5, 3, 4, 2};
+    }
+};
+
+#endif //OPTIMIZEDKIT_SMALL_GRAPH_FIXTURE_HPP
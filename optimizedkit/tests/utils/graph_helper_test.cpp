@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "utils/graph_helper.hpp"
+
+using namespace OptimizedKit;
+
+TEST(GraphHelperTests, ComputeStronglyConnectedComponents_WithCycleAndTail_NumbersInReverseTopologicalOrder) {
+    // Arrange
+    std::vector<VertexId> tail = {0, 1, 2, 2, 3};
+    std::vector<VertexId> head = {1, 2, 0, 3, 4};
+
+    // Act
+    auto component = computeStronglyConnectedComponents(6, tail, head);
+
+    // Assert
+    ASSERT_EQ(component[0], component[1]);
+    ASSERT_EQ(component[1], component[2]);
+    ASSERT_GT(component[0], component[3]);
+    ASSERT_GT(component[3], component[4]);
+    ASSERT_NE(component[5], component[0]);
+    ASSERT_NE(component[5], component[3]);
+    ASSERT_NE(component[5], component[4]);
+}
+
+TEST(GraphHelperTests, ComputeWeaklyConnectedComponents_WithTwoIslands_NumbersConsecutively) {
+    // Arrange
+    std::vector<VertexId> tail = {0, 3, 4};
+    std::vector<VertexId> head = {2, 1, 3};
+
+    // Act
+    auto component = computeWeaklyConnectedComponents(5, tail, head);
+
+    // Assert
+    ASSERT_EQ(component, std::vector<VertexId>({0, 1, 0, 1, 1}));
+}
+
+TEST(GraphHelperTests, ComputeForestPostOrder_WithScatteredTree_SubtreesContiguousAndRootsLast) {
+    // Arrange, 4 is the root of {0, 2, 4} and 5 the root of {1, 3, 5}.
+    std::vector<VertexId> parent = {4, 3, 4, 5, INVALID_VALUE<VertexId>, INVALID_VALUE<VertexId>};
+
+    // Act
+    auto newId = computeForestPostOrder(parent);
+
+    // Assert
+    ASSERT_EQ(newId, std::vector<VertexId>({0, 3, 1, 4, 2, 5}));
+}
+
+TEST(GraphHelperTests, ComputeForestPostOrder_WithPostOrderedForest_ReturnsIdentity) {
+    // Arrange
+    std::vector<VertexId> parent = {2, 2, 5, 4, 5, INVALID_VALUE<VertexId>, INVALID_VALUE<VertexId>};
+
+    // Act
+    auto newId = computeForestPostOrder(parent);
+
+    // Assert
+    ASSERT_EQ(newId, std::vector<VertexId>({0, 1, 2, 3, 4, 5, 6}));
+}
@@ -0,0 +1,81 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <cstdint>
+#include <numeric>
+#include "utils/huge_pages.hpp"
+#include "utils/huge_page_allocator.hpp"
+
+using namespace OptimizedKit;
+
+TEST(HugePagesTests, HugePageAllocator_LargeVector_AlignedToHugePages) {
+    // Arrange
+    HugePageAllocator<unsigned> allocator(HugePagePolicy::TRANSPARENT);
+
+    // Act
+    std::vector<unsigned, HugePageAllocator<unsigned>> values(HUGE_PAGE_SIZE, 0, allocator);
+    std::iota(values.begin(), values.end(), 0u);
+
+    // Assert
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % HUGE_PAGE_SIZE, 0);
+    EXPECT_EQ(values.front(), 0);
+    EXPECT_EQ(values.back(), HUGE_PAGE_SIZE - 1);
+}
+
+TEST(HugePagesTests, HugePageAllocator_ExplicitPolicy_FallsBackWithoutReservedPages) {
+    // Arrange
+    HugePageAllocator<std::uint64_t> allocator(HugePagePolicy::EXPLICIT);
+
+    // Act
+    std::vector<std::uint64_t, HugePageAllocator<std::uint64_t>> values(3 * HUGE_PAGE_SIZE / 8 + 1, 7, allocator);
+
+    // Assert
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % HUGE_PAGE_SIZE, 0);
+    EXPECT_EQ(values.back(), 7);
+}
+
+TEST(HugePagesTests, HugePageAllocator_SmallVector_KeepsAlignment) {
+    // Arrange
+    HugePageAllocator<unsigned, 64> allocator(HugePagePolicy::TRANSPARENT);
+
+    // Act
+    std::vector<unsigned, HugePageAllocator<unsigned, 64>> values(5, 1, allocator);
+
+    // Assert
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(values.data()) % 64, 0);
+}
+
+TEST(HugePagesTests, HugePageAllocator_MoveAssignment_PropagatesPolicy) {
+    // Arrange
+    std::vector<unsigned, HugePageAllocator<unsigned>> values;
+
+    // Act
+    values = std::vector<unsigned, HugePageAllocator<unsigned>>(HugePageAllocator<unsigned>(HugePagePolicy::TRANSPARENT));
+
+    // Assert
+    EXPECT_EQ(values.get_allocator().getPolicy(), HugePagePolicy::TRANSPARENT);
+}
+
+TEST(HugePagesTests, AdviseHugePages_LargeVector_AdvisesAlignedInterior) {
+    // Arrange
+    std::vector<char> bytes(3 * HUGE_PAGE_SIZE);
+
+    // Act
+    auto advised = adviseHugePages(bytes, HugePagePolicy::TRANSPARENT);
+    auto unadvised = adviseHugePages(bytes, HugePagePolicy::NONE);
+
+    // Assert
+    EXPECT_EQ(advised % HUGE_PAGE_SIZE, 0);
+    EXPECT_LE(advised, bytes.size());
+    EXPECT_EQ(unadvised, 0);
+}
+
+TEST(HugePagesTests, AdviseHugePages_SmallVector_AdvisesNothing) {
+    // Arrange
+    std::vector<char> bytes(HUGE_PAGE_SIZE / 2);
+
+    // Act
+    auto advised = adviseHugePages(bytes, HugePagePolicy::TRANSPARENT);
+
+    // Assert
+    EXPECT_EQ(advised, 0);
+}
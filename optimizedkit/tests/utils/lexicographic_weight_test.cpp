@@ -0,0 +1,56 @@
+#include "gtest/gtest.h"
+#include "utils/lexicographic_weight.hpp"
+
+using namespace OptimizedKit;
+
+TEST(LexicographicWeightTests, Compare_EqualPrimary_OrderedBySecondary) {
+    // Arrange
+    LexicographicWeight shorter(5, 100);
+    LexicographicWeight longer(5, 101);
+    LexicographicWeight slower(6, 0);
+
+    // Act & Assert
+    EXPECT_LT(shorter, longer);
+    EXPECT_LT(longer, slower);
+    EXPECT_LT(slower, INFINITY_WEIGHT<LexicographicWeight>);
+}
+
+TEST(LexicographicWeightTests, Add_FiniteWeights_AddsBothCriteria) {
+    // Arrange
+    LexicographicWeight a(3, 40);
+    LexicographicWeight b(4, 2);
+
+    // Act
+    auto sum = a + b;
+
+    // Assert
+    EXPECT_EQ(sum, LexicographicWeight(7, 42));
+}
+
+TEST(LexicographicWeightTests, Add_ReachingInfinity_SaturatesToInfinity) {
+    // Arrange
+    LexicographicWeight a(LexicographicWeight::INFINITE_PRIMARY - 1, 7);
+    LexicographicWeight b(1, 3);
+
+    // Act
+    auto sum = a + b;
+    auto infiniteSum = INFINITY_WEIGHT<LexicographicWeight> + INFINITY_WEIGHT<LexicographicWeight>;
+
+    // Assert
+    EXPECT_EQ(sum, INFINITY_WEIGHT<LexicographicWeight>);
+    EXPECT_EQ(infiniteSum, INFINITY_WEIGHT<LexicographicWeight>);
+    EXPECT_TRUE(sum.isInfinite());
+}
+
+TEST(LexicographicWeightTests, Add_SecondaryOverflow_ClampsSecondary) {
+    // Arrange
+    LexicographicWeight a(1, std::numeric_limits<std::uint32_t>::max() - 1);
+    LexicographicWeight b(1, 5);
+
+    // Act
+    auto sum = a + b;
+
+    // Assert
+    EXPECT_EQ(sum.primary(), 2u);
+    EXPECT_EQ(sum.secondary(), std::numeric_limits<std::uint32_t>::max());
+}
@@ -0,0 +1,62 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <thread>
+#include "utils/memory_tracker.hpp"
+
+using namespace OptimizedKit;
+
+TEST(MemoryTrackerTests, BeginPhase_TrackedAllocations_RecordsPeakPerPhase) {
+    // Arrange
+    MemoryPhaseRecording recording;
+    std::vector<unsigned, TrackingAllocator<unsigned>> persistent;
+
+    // Act
+    MemoryTracker::beginPhase("first");
+    persistent.reserve(100);
+    {
+        std::vector<unsigned, TrackingAllocator<unsigned>> temporary;
+        temporary.reserve(1000);
+    }
+    MemoryTracker::beginPhase("second");
+    persistent.shrink_to_fit();
+    MemoryTracker::endPhase();
+    auto phases = recording.phases();
+
+    // Assert
+    ASSERT_EQ(phases.size(), 2);
+    EXPECT_EQ(phases[0].name, "first");
+    EXPECT_EQ(phases[0].peakAdditionalBytes(), 1100 * sizeof(unsigned));
+    EXPECT_EQ(phases[0].endBytes - phases[0].startBytes, 100 * sizeof(unsigned));
+    EXPECT_EQ(phases[1].name, "second");
+    EXPECT_EQ(phases[1].peakAdditionalBytes(), 0);
+}
+
+TEST(MemoryTrackerTests, BeginPhase_WithoutRecording_KeepsNoPhases) {
+    // Arrange
+    MemoryTracker::beginPhase("beforeRecording");
+    MemoryTracker::endPhase();
+    MemoryPhaseRecording recording;
+
+    // Act
+    std::thread([] { MemoryTracker::beginPhase("otherThread"); }).join();
+    MemoryTracker::beginPhase("recorded");
+    auto phases = recording.phases();
+
+    // Assert
+    ASSERT_EQ(phases.size(), 1);
+    EXPECT_EQ(phases[0].name, "recorded");
+}
+
+TEST(MemoryTrackerTests, TrackingAllocator_VectorDestroyed_LiveBytesRestored) {
+    // Arrange
+    auto liveBefore = MemoryTracker::liveBytes();
+
+    // Act
+    auto *values = new std::vector<double, TrackingAllocator<double>>(64);
+    auto liveDuring = MemoryTracker::liveBytes();
+    delete values;
+
+    // Assert
+    EXPECT_EQ(liveDuring - liveBefore, 64 * sizeof(double));
+    EXPECT_EQ(MemoryTracker::liveBytes(), liveBefore);
+}
@@ -0,0 +1,40 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <sstream>
+#include "utils/memory_usage.hpp"
+
+using namespace OptimizedKit;
+
+TEST(MemoryUsageTests, Add_VectorsAndBitVectors_CountsCapacity) {
+    // Arrange
+    std::vector<unsigned> values;
+    values.reserve(10);
+    std::vector<bool> flags(17);
+    MemoryUsage usage;
+
+    // Act
+    usage.add("values", values).add("flags", flags);
+
+    // Assert
+    EXPECT_EQ(usage.bytesOf("values"), 10 * sizeof(unsigned));
+    EXPECT_EQ(usage.bytesOf("flags"), (flags.capacity() + 7) / 8);
+    EXPECT_EQ(usage.totalBytes(), usage.bytesOf("values") + usage.bytesOf("flags"));
+    EXPECT_EQ(usage.bytesOf("missing"), 0);
+}
+
+TEST(MemoryUsageTests, Add_NestedUsage_PrefixesNames) {
+    // Arrange
+    MemoryUsage nested;
+    nested.add("head", 12).add("tail", 8);
+    MemoryUsage usage;
+    std::stringstream stream;
+
+    // Act
+    usage.add("graph", nested);
+    stream << usage;
+
+    // Assert
+    EXPECT_EQ(usage.bytesOf("graph.head"), 12);
+    EXPECT_EQ(usage.bytesOf("graph.tail"), 8);
+    EXPECT_EQ(stream.str(), "graph.head: 12 bytes\ngraph.tail: 8 bytes\ntotal: 20 bytes\n");
+}
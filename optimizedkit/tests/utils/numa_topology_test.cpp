@@ -0,0 +1,45 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include "utils/numa_topology.hpp"
+
+using namespace OptimizedKit;
+
+TEST(NumaTopologyTests, ParseCpuList_RangesAndSingleCpus_ListsAllCpus) {
+    // Arrange
+    std::string cpuList = "0-2,5,8-9\n";
+
+    // Act
+    auto cpus = parseCpuList(cpuList);
+
+    // Assert
+    EXPECT_EQ(cpus, std::vector<unsigned>({0, 1, 2, 5, 8, 9}));
+}
+
+TEST(NumaTopologyTests, NumaNodeCpus_AnySystem_ReportsNodesWithCpus) {
+    // Act
+    auto nodes = numaNodeCpus();
+
+    // Assert
+    ASSERT_FALSE(nodes.empty());
+    for (const auto &cpus: nodes)
+        EXPECT_FALSE(cpus.empty());
+}
+
+TEST(NumaTopologyTests, PinCurrentThread_CpusOfFirstNode_RunsOnThem) {
+    // Arrange
+    auto cpus = numaNodeCpus().front();
+    bool pinned = false;
+    unsigned cpu = 0;
+
+    // Act
+    std::thread([&] {
+        pinned = pinCurrentThread(cpus);
+        cpu = currentCpu();
+    }).join();
+
+    // Assert
+    ASSERT_TRUE(pinned);
+    EXPECT_NE(std::find(cpus.begin(), cpus.end(), cpu), cpus.end());
+}
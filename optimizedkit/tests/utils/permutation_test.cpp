@@ -67,9 +67,9 @@ TEST(PermutationTests, InvertPermutation_ValidPermutation_ReturnsInversePermutat
 
 TEST(PermutationTests, InplaceApplyPermutationToElementsOf_ValidPermutation_ReturnsPermutedVector) {
     // Arrange
-    std::vector<unsigned> permutation = {1, 2, 3, 0};
-    std::vector<unsigned> vec = {1, 2, 3, 0};
-    std::vector<unsigned> expected = {2, 3, 0, 1};
+    std::vector<VertexId> permutation = {1, 2, 3, 0};
+    std::vector<VertexId> vec = {1, 2, 3, 0};
+    std::vector<VertexId> expected = {2, 3, 0, 1};
 
     // Act
     inplaceApplyPermutationToElementsOf(permutation, vec);
@@ -80,9 +80,9 @@ TEST(PermutationTests, InplaceApplyPermutationToElementsOf_ValidPermutation_Retu
 
 TEST(PermutationTests, ApplyPermutationToElementsOf_ValidPermutation_ReturnsPermutedVector) {
     // Arrange
-    std::vector<unsigned> permutation = {1, 2, 3, 0};
-    std::vector<unsigned> vec = {1, 2, 3, 0};
-    std::vector<unsigned> expected = {2, 3, 0, 1};
+    std::vector<VertexId> permutation = {1, 2, 3, 0};
+    std::vector<VertexId> vec = {1, 2, 3, 0};
+    std::vector<VertexId> expected = {2, 3, 0, 1};
 
     // Act
     auto actual = applyPermutationToElementsOf(permutation, vec);
@@ -119,9 +119,9 @@ TEST(PermutationTests, ApplyInversePermutation_ValidPermutation_ReturnsInversePe
 
 TEST(PermutationTests, ChainPermutationFirstLeftThenRight_ValidPermutations_ReturnsChainedPermutation) {
     // Arrange
-    std::vector<unsigned> permutationLeft = {1, 2, 3, 0};
-    std::vector<unsigned> permutationRight = {1, 2, 3, 0};
-    std::vector<unsigned> expected = {2, 3, 0, 1};
+    std::vector<EdgeId> permutationLeft = {1, 2, 3, 0};
+    std::vector<EdgeId> permutationRight = {1, 2, 3, 0};
+    std::vector<EdgeId> expected = {2, 3, 0, 1};
 
     // Act
     auto actual = chainPermutationFirstLeftThenRight(permutationLeft, permutationRight);
@@ -133,10 +133,10 @@ TEST(PermutationTests, ChainPermutationFirstLeftThenRight_ValidPermutations_Retu
 TEST(PermutationTests,
      ComputeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail_validGraph_ReturnsInverseSortPermutationAndSortedTail) {
     // Arrange
-    std::vector<unsigned> head = {3, 1, 0, 2};
-    std::vector<unsigned> tail = {1, 2, 3, 0};
-    std::vector<unsigned> expectedPermutation = { 1, 2, 3, 0 };
-    std::vector<unsigned> expectedSortedTail = {0, 1, 2, 3};
+    std::vector<VertexId> head = {3, 1, 0, 2};
+    std::vector<VertexId> tail = {1, 2, 3, 0};
+    std::vector<EdgeId> expectedPermutation = { 1, 2, 3, 0 };
+    std::vector<VertexId> expectedSortedTail = {0, 1, 2, 3};
 
     // Act
     auto actualPermutation = computeInverseSortPermutationFirstByTailThenByHeadAndApplySortToTail(tail, head);
@@ -151,10 +151,10 @@ TEST(PermutationTests,
 TEST(PermutationTests,
      ComputeSortPermutationFirstByTailThenByHeadAndApplySortToTail_validGraph_ReturnsSortPermutationAndSortedTail) {
     // Arrange
-    std::vector<unsigned> head = {3, 1, 0, 2};
-    std::vector<unsigned> tail = {1, 2, 3, 0};
-    std::vector<unsigned> expectedPermutation = { 3, 0, 1, 2 };
-    std::vector<unsigned> expectedSortedTail = {0, 1, 2, 3};
+    std::vector<VertexId> head = {3, 1, 0, 2};
+    std::vector<VertexId> tail = {1, 2, 3, 0};
+    std::vector<EdgeId> expectedPermutation = { 3, 0, 1, 2 };
+    std::vector<VertexId> expectedSortedTail = {0, 1, 2, 3};
 
     // Act
     auto actualPermutation = computeSortPermutationFirstByTailThenByHeadAndApplySortToTail(tail, head);
@@ -169,7 +169,7 @@ TEST(PermutationTests,
 TEST(PermutationTests, ComputeStableSortPermutation_RandomHeadVector_ReturnsStableSortPermutation) {
     // Arrange
     std::vector<unsigned> head = {3, 1, 0, 2};
-    std::vector<unsigned> expectedPermutation = { 2, 1, 3, 0 };
+    std::vector<EdgeId> expectedPermutation = { 2, 1, 3, 0 };
 
     // Act
     auto actualPermutation = computeStableSortPermutation(head);
@@ -182,7 +182,7 @@ TEST(PermutationTests, ComputeStableSortPermutation_RandomHeadVector_ReturnsStab
 TEST(PermutationTests, ComputeInverseStableSortPermutation_RandomHeadVector_ReturnsInverseStableSortPermutation) {
     // Arrange
     std::vector<unsigned> head = {3, 1, 0, 2};
-    std::vector<unsigned> expectedPermutation = {3, 1, 0, 2};
+    std::vector<EdgeId> expectedPermutation = {3, 1, 0, 2};
 
     // Act
     auto actualPermutation = computeInverseStableSortPermutation(head);
@@ -194,7 +194,7 @@ TEST(PermutationTests, ComputeInverseStableSortPermutation_RandomHeadVector_Retu
 TEST(PermutationTests, ComputeStableSortPermutation_LongerHeadVector_ReturnsStableSortPermutation) {
     // Arrange
     std::vector<unsigned> head = {0, 4, 4, 2, 3, 3};
-    std::vector<unsigned> expectedPermutation = {0, 3, 4, 5, 1, 2};
+    std::vector<EdgeId> expectedPermutation = {0, 3, 4, 5, 1, 2};
 
     // Act
     auto actualPermutation = computeStableSortPermutation(head);
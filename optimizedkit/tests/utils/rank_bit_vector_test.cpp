@@ -0,0 +1,82 @@
+#include "gtest/gtest.h"
+#include "utils/rank_bit_vector.hpp"
+#include "utils/id_mapper.hpp"
+
+using namespace OptimizedKit;
+
+TEST(RankBitVectorTests, Constructor_WithFilter_SetsBits) {
+    // Arrange
+    Filter filter = {true, false, true, true};
+
+    // Act
+    RankBitVector bitVector(filter);
+
+    // Assert
+    ASSERT_EQ(bitVector.size(), 4);
+    ASSERT_EQ(bitVector.count(), 3);
+    ASSERT_TRUE(bitVector[0]);
+    ASSERT_FALSE(bitVector[1]);
+    ASSERT_TRUE(bitVector[2]);
+    ASSERT_TRUE(bitVector[3]);
+}
+
+TEST(RankBitVectorTests, Rank_SetId_ReturnsLocalId) {
+    // Arrange
+    Filter filter = {true, true, false, true};
+    RankBitVector bitVector(filter);
+
+    // Act
+    auto actual = bitVector.rank(3);
+
+    // Assert
+    ASSERT_EQ(actual, 2);
+}
+
+TEST(RankBitVectorTests, Rank_AcrossBlocks_MatchesIdMapper) {
+    // Arrange
+    Filter filter(1000);
+    for (unsigned id = 0; id < filter.size(); ++id)
+        filter[id] = id % 3 == 0 || id % 7 == 0 || (id >= 128 && id < 200);
+    IdMapper idMapper(filter);
+
+    // Act
+    RankBitVector bitVector(filter);
+
+    // Assert
+    for (unsigned id = 0; id < filter.size(); ++id) {
+        if (filter[id]) {
+            ASSERT_EQ(bitVector.rank(id), idMapper.toLocal(id));
+        }
+    }
+    ASSERT_EQ(bitVector.rank(filter.size()), idMapper.getLocalIdCount());
+    ASSERT_EQ(bitVector.count(), idMapper.getLocalIdCount());
+}
+
+TEST(RankBitVectorTests, Remove_GivenFilter_KeepsOrderOfRemainingIds) {
+    // Arrange
+    RankBitVector bitVector(Filter{true, false, true, true, false});
+    Filter removeFilter = {false, true, true, false, false};
+
+    // Act
+    bitVector.remove(removeFilter);
+
+    // Assert
+    ASSERT_EQ(bitVector.size(), 3);
+    ASSERT_EQ(bitVector.count(), 2);
+    ASSERT_TRUE(bitVector[0]);
+    ASSERT_TRUE(bitVector[1]);
+    ASSERT_FALSE(bitVector[2]);
+    ASSERT_EQ(bitVector.rank(1), 1);
+}
+
+TEST(RankBitVectorTests, MemoryUsage_ManyIds_AboutOneAndAQuarterBitsPerId) {
+    // Arrange
+    Filter filter(1 << 16, true);
+
+    // Act
+    RankBitVector bitVector(filter);
+
+    // Assert
+    auto bits = 8 * bitVector.memoryUsage().totalBytes();
+    ASSERT_LE(bits, filter.size() * 5 / 4 + 512);
+}
@@ -41,8 +41,8 @@ TEST(VectorHelperTests, MaxElementOfVector_NonEmptyVector_ReturnsMax) {
 
 TEST(VectorHelperTests, InvertedVectorMirror_ValidSortedVector_CorrectInverse) {
     // Arrange
-    std::vector<unsigned> vec = {0, 2, 4};
-    std::vector<unsigned> expected = {0, 1, 1, 2, 2, 3};
+    std::vector<VertexId> vec = {0, 2, 4};
+    std::vector<EdgeId> expected = {0, 1, 1, 2, 2, 3};
 
     // Act
     auto actual = constructAdjacencyIndices(vec, 5);
@@ -89,3 +89,19 @@ TEST(VectorHelperTests, RemoveIdsAndAdjustElementsInplace_ValidVectors_CorrectFi
     ASSERT_EQ(actual, expected);
 }
 
+
+TEST(VectorHelperTests, RemoveAdjacencyListsByFilter_ValidVectors_CorrectRemainingLists) {
+    // Arrange
+    std::vector<unsigned> actualIndices = {0, 2, 3, 3, 6};
+    std::vector<unsigned> actualElements = {10, 11, 20, 40, 41, 42};
+    Filter filter = {true, false, false, false}; // remove the first list
+    std::vector<unsigned> expectedIndices = {0, 1, 1, 4};
+    std::vector<unsigned> expectedElements = {20, 40, 41, 42};
+
+    // Act
+    removeAdjacencyListsByFilter(actualIndices, actualElements, filter);
+
+    // Assert
+    ASSERT_EQ(actualIndices, expectedIndices);
+    ASSERT_EQ(actualElements, expectedElements);
+}
@@ -0,0 +1,69 @@
+#include "gtest/gtest.h"
+#include <cstdint>
+#include "utils/constants.hpp"
+#include "utils/weight_traits.hpp"
+
+using namespace OptimizedKit;
+
+TEST(WeightTraitsTests, Infinity_32BitWeights_SameAsRoutingKit) {
+    // Act & Assert
+    EXPECT_EQ(INFINITY_WEIGHT<unsigned>, 2147483647u);
+    EXPECT_EQ(INFINITY_WEIGHT<std::uint16_t>, 32767u);
+    EXPECT_EQ(INFINITY_WEIGHT<double>, std::numeric_limits<double>::infinity());
+}
+
+TEST(WeightTraitsTests, Add_16BitWeightsReachingInfinity_SaturatesToInfinity) {
+    // Arrange
+    std::uint16_t a = 30000;
+    std::uint16_t b = 2767;
+
+    // Act
+    auto sum = WeightTraits<std::uint16_t>::add(a, b);
+    auto infiniteSum = WeightTraits<std::uint16_t>::add(INFINITY_WEIGHT<std::uint16_t>, INFINITY_WEIGHT<std::uint16_t>);
+
+    // Assert
+    EXPECT_EQ(sum, INFINITY_WEIGHT<std::uint16_t>);
+    EXPECT_EQ(infiniteSum, INFINITY_WEIGHT<std::uint16_t>);
+    EXPECT_EQ(WeightTraits<std::uint16_t>::add(a, 2766), 32766);
+}
+
+TEST(WeightTraitsTests, Add_LargeUnsigned64BitWeights_SaturatesInsteadOfWrapping) {
+    // Arrange
+    auto a = INFINITY_WEIGHT<std::uint64_t> - 1;
+    std::uint64_t b = 1ull << 62;
+
+    // Act
+    auto sum = WeightTraits<std::uint64_t>::add(a, b);
+
+    // Assert
+    EXPECT_EQ(sum, INFINITY_WEIGHT<std::uint64_t>);
+    EXPECT_TRUE(WeightTraits<std::uint64_t>::isInfinite(sum));
+}
+
+TEST(WeightTraitsTests, Add_SignedWeightsReachingInfinity_SaturatesToInfinity) {
+    // Arrange
+    int a = 2000000000;
+    int b = 147483647;
+
+    // Act
+    auto sum = WeightTraits<int>::add(a, b);
+    auto infiniteSum = WeightTraits<int>::add(INFINITY_WEIGHT<int>, INFINITY_WEIGHT<int>);
+
+    // Assert
+    EXPECT_EQ(INFINITY_WEIGHT<int>, 2147483647);
+    EXPECT_EQ(sum, INFINITY_WEIGHT<int>);
+    EXPECT_EQ(infiniteSum, INFINITY_WEIGHT<int>);
+    EXPECT_EQ(WeightTraits<int>::add(a, b - 1), 2147483646);
+}
+
+TEST(WeightTraitsTests, Add_FloatWeightsNearLimit_SaturatesToInfinity) {
+    // Arrange
+    float a = std::numeric_limits<float>::max();
+
+    // Act
+    auto sum = WeightTraits<float>::add(a, a);
+
+    // Assert
+    EXPECT_TRUE(WeightTraits<float>::isInfinite(sum));
+    EXPECT_EQ(WeightTraits<float>::min(sum, a), a);
+}
@@ -0,0 +1,36 @@
+#include "gtest/gtest.h"
+#include <vector>
+#include <atomic>
+#include <thread>
+#include "utils/worker_pool.hpp"
+
+using namespace OptimizedKit;
+
+TEST(WorkerPoolTests, Run_RepeatedTasks_EveryThreadRunsEveryTask) {
+    // Arrange
+    WorkerPool pool(4);
+    std::vector<std::atomic<unsigned>> runs(pool.size());
+
+    // Act
+    for (int task = 0; task < 100; ++task)
+        pool.run([&](unsigned thread) { ++runs[thread]; });
+
+    // Assert
+    ASSERT_EQ(pool.size(), 4);
+    for (const auto &count: runs)
+        EXPECT_EQ(count, 100);
+}
+
+TEST(WorkerPoolTests, Run_SingleThread_RunsOnCallingThread) {
+    // Arrange
+    WorkerPool pool(1);
+    auto caller = std::this_thread::get_id();
+    std::thread::id runner;
+
+    // Act
+    pool.run([&](unsigned thread) { runner = std::this_thread::get_id(); });
+
+    // Assert
+    ASSERT_EQ(pool.size(), 1);
+    ASSERT_EQ(runner, caller);
+}